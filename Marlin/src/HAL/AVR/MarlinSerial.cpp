@@ -55,6 +55,8 @@ template<typename Cfg> uint8_t  MarlinSerial<Cfg>::rx_dropped_bytes = 0;
 template<typename Cfg> uint8_t  MarlinSerial<Cfg>::rx_buffer_overruns = 0;
 template<typename Cfg> uint8_t  MarlinSerial<Cfg>::rx_framing_errors = 0;
 template<typename Cfg> typename MarlinSerial<Cfg>::ring_buffer_pos_t MarlinSerial<Cfg>::rx_max_enqueued = 0;
+template<typename Cfg> uint32_t MarlinSerial<Cfg>::tx_blocked_ms_total = 0;
+template<typename Cfg> uint16_t MarlinSerial<Cfg>::tx_blocked_us = 0;
 
 // A SW memory barrier, to ensure GCC does not overoptimize loops
 #define sw_barrier() asm volatile("": : :"memory");
@@ -498,9 +500,16 @@ void MarlinSerial<Cfg>::write(const uint8_t c) {
         sw_barrier();
       }
     }
-    else {
+    else if (i == tx_buffer.tail) {
       // Interrupts are enabled, just wait until there is space
+      const uint32_t blocked_us = Cfg::TX_BLOCKED ? micros() : 0;
       while (i == tx_buffer.tail) sw_barrier();
+      if (Cfg::TX_BLOCKED) {
+        // Keep whole milliseconds and carry the remainder so short waits still add up
+        const uint32_t us = tx_blocked_us + (micros() - blocked_us);
+        tx_blocked_ms_total += us / 1000;
+        tx_blocked_us = us % 1000;
+      }
     }
 
     // Store new char. head is always safe to move
@@ -512,6 +521,43 @@ void MarlinSerial<Cfg>::write(const uint8_t c) {
   }
 }
 
+template<typename Cfg>
+void MarlinSerial<Cfg>::write(const uint8_t* buffer, size_t size) {
+  // Unbuffered, or polling from an ISR, goes byte by byte
+  if (Cfg::TX_SIZE == 0 || !ISRS_ENABLED()) {
+    while (size--) write(*buffer++);
+    return;
+  }
+
+  _written = true;
+
+  while (size) {
+    // Copy as much as fits, moving the head once. Only the ISR moves the tail.
+    const uint8_t h = tx_buffer.head;
+    uint8_t count = (tx_buffer.tail - h - 1) & (Cfg::TX_SIZE - 1);
+
+    // Full, so wait for room the same as a single byte
+    if (!count) { write(*buffer++); size--; continue; }
+
+    NOMORE(count, size);
+    size -= count;
+    uint8_t p = h;
+    while (count--) {
+      tx_buffer.buffer[p] = *buffer++;
+      p = (p + 1) & (Cfg::TX_SIZE - 1);
+    }
+    tx_buffer.head = p;
+
+    // Enable TX ISR
+    B_UDRIE = 1;
+  }
+}
+
+template<typename Cfg>
+uint8_t MarlinSerial<Cfg>::availableForWrite() {
+  return Cfg::TX_SIZE ? (tx_buffer.tail - tx_buffer.head - 1) & (Cfg::TX_SIZE - 1) : 0;
+}
+
 template<typename Cfg>
 void MarlinSerial<Cfg>::flushTX() {
 
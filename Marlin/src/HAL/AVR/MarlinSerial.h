@@ -193,6 +193,8 @@
                    rx_buffer_overruns,
                    rx_framing_errors;
     static ring_buffer_pos_t rx_max_enqueued;
+    static uint32_t tx_blocked_ms_total;
+    static uint16_t tx_blocked_us;
 
     static FORCE_INLINE ring_buffer_pos_t atomic_read_rx_head();
 
@@ -216,7 +218,9 @@
       static void flush();
       static ring_buffer_pos_t available();
       static void write(const uint8_t c);
+      static void write(const uint8_t* buffer, size_t size);
       static void flushTX();
+      static uint8_t availableForWrite();
       #if HAS_DGUS_LCD
         static ring_buffer_pos_t get_tx_buffer_free();
       #endif
@@ -227,9 +231,9 @@
       FORCE_INLINE static uint8_t buffer_overruns() { return Cfg::RX_OVERRUNS ? rx_buffer_overruns : 0; }
       FORCE_INLINE static uint8_t framing_errors() { return Cfg::RX_FRAMING_ERRORS ? rx_framing_errors : 0; }
       FORCE_INLINE static ring_buffer_pos_t rxMaxEnqueued() { return Cfg::MAX_RX_QUEUED ? rx_max_enqueued : 0; }
+      FORCE_INLINE static uint32_t tx_blocked_ms() { return Cfg::TX_BLOCKED ? tx_blocked_ms_total : 0; }
 
-      FORCE_INLINE static void write(const char* str) { while (*str) write(*str++); }
-      FORCE_INLINE static void write(const uint8_t* buffer, size_t size) { while (size--) write(*buffer++); }
+      FORCE_INLINE static void write(const char* str) { write((const uint8_t*)str, strlen(str)); }
       FORCE_INLINE static void print(const String& s) { for (int i = 0; i < (int)s.length(); i++) write(s[i]); }
       FORCE_INLINE static void print(const char* str) { write(str); }
 
@@ -269,6 +273,7 @@
     static constexpr bool RX_OVERRUNS       = ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS);
     static constexpr bool RX_FRAMING_ERRORS = ENABLED(SERIAL_STATS_RX_FRAMING_ERRORS);
     static constexpr bool MAX_RX_QUEUED     = ENABLED(SERIAL_STATS_MAX_RX_QUEUED);
+    static constexpr bool TX_BLOCKED        = ENABLED(SERIAL_STATS_TX_BLOCKED);
   };
   extern MarlinSerial<MarlinSerialCfg<SERIAL_PORT>> customizedSerial1;
 
@@ -292,6 +297,7 @@
     static constexpr unsigned int RX_SIZE   = 32;
     static constexpr unsigned int TX_SIZE   = 32;
     static constexpr bool RX_OVERRUNS       = false;
+    static constexpr bool TX_BLOCKED        = false;
   };
 
   extern MarlinSerial<MMU2SerialCfg<MMU2_SERIAL_PORT>> mmuSerial;
@@ -307,6 +313,7 @@
     static constexpr bool DROPPED_RX          = false;
     static constexpr bool RX_FRAMING_ERRORS   = false;
     static constexpr bool MAX_RX_QUEUED       = false;
+    static constexpr bool TX_BLOCKED          = false;
     #if HAS_DGUS_LCD
       static constexpr unsigned int RX_SIZE   = DGUS_RX_BUFFER_SIZE;
       static constexpr unsigned int TX_SIZE   = DGUS_TX_BUFFER_SIZE;
@@ -359,6 +359,11 @@ typename MarlinSerial<Cfg>::ring_buffer_pos_t MarlinSerial<Cfg>::available() {
   return (ring_buffer_pos_t)(Cfg::RX_SIZE + h - t) & (Cfg::RX_SIZE - 1);
 }
 
+template<typename Cfg>
+uint8_t MarlinSerial<Cfg>::availableForWrite() {
+  return Cfg::TX_SIZE ? (tx_buffer.tail - tx_buffer.head - 1) & (Cfg::TX_SIZE - 1) : 0;
+}
+
 template<typename Cfg>
 void MarlinSerial<Cfg>::flush() {
   rx_buffer.tail = rx_buffer.head;
@@ -121,6 +121,7 @@ public:
   static ring_buffer_pos_t available();
   static void write(const uint8_t c);
   static void flushTX();
+  static uint8_t availableForWrite();
 
   static inline bool emergency_parser_enabled() { return Cfg::EMERGENCYPARSER; }
 
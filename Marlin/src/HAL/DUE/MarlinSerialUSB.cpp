@@ -45,6 +45,7 @@ extern "C" {
   int udi_cdc_getc();
   bool udi_cdc_is_tx_ready();
   int udi_cdc_putc(int value);
+  uint32_t udi_cdc_get_free_tx_buffer();
 };
 
 // Pending character
@@ -111,6 +112,12 @@ bool MarlinSerialUSB::available() {
 void MarlinSerialUSB::flush() { }
 void MarlinSerialUSB::flushTX() { }
 
+uint8_t MarlinSerialUSB::availableForWrite() {
+  // Without a listening host nothing is sent, so nothing can block
+  if (!usb_task_cdc_isenabled() || !usb_task_cdc_dtr_active()) return 255;
+  return _MIN(udi_cdc_get_free_tx_buffer(), 255U);
+}
+
 void MarlinSerialUSB::write(const uint8_t c) {
 
   /* Do not even bother sending anything if USB CDC is not enumerated
@@ -47,6 +47,7 @@ public:
   static int read();
   static void flush();
   static void flushTX();
+  static uint8_t availableForWrite();
   static bool available();
   static void write(const uint8_t c);
 
@@ -59,3 +59,8 @@
 #if HAS_TMC_SW_SERIAL
   #error "TMC220x Software Serial is not supported on this platform."
 #endif
+
+// Hardware serial ports can only have TX_BUFFER_SIZE - 1 bytes free
+#if defined(SERIAL_DROP_AUTO_REPORTS) && (SERIAL_PORT >= 0 || (defined(SERIAL_PORT_2) && SERIAL_PORT_2 >= 0)) && SERIAL_DROP_AUTO_REPORTS >= TX_BUFFER_SIZE
+  #error "SERIAL_DROP_AUTO_REPORTS must be less than TX_BUFFER_SIZE on a hardware serial port."
+#endif
@@ -41,6 +41,11 @@ extern "C" void u8g_Delay(uint16_t val) {
 }
 //************************//
 
+// On the virtual clock an idle firmware simply waits for the next event
+void HAL_idletask() {
+  if (Clock::isVirtualTime()) Clock::runNextEvent();
+}
+
 // return free heap space
 int freeMemory() {
   return 0;
@@ -78,6 +78,9 @@ extern HalSerial usb_serial;
 
 inline void HAL_init() {}
 
+#define HAL_IDLETASK 1
+void HAL_idletask();
+
 // Utility functions
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
@@ -28,4 +28,51 @@ std::chrono::nanoseconds Clock::startup = std::chrono::high_resolution_clock::no
 uint32_t Clock::frequency = F_CPU;
 double Clock::time_multiplier = 1.0;
 
+bool Clock::virtual_time = false;
+bool Clock::in_event = false;
+uint64_t Clock::virtual_nanos = 0;
+uint64_t Clock::event_count = 0;
+ClockEventSource* Clock::sources[Clock::max_sources] = {};
+uint8_t Clock::source_count = 0;
+
+void Clock::attach(ClockEventSource* source) {
+  if (source_count < max_sources) sources[source_count++] = source;
+}
+
+ClockEventSource* Clock::nextSource(uint64_t &due) {
+  ClockEventSource* next = nullptr;
+  due = NEVER;
+  for (uint8_t i = 0; i < source_count; i++) {
+    const uint64_t t = sources[i]->nextEvent();
+    if (t < due) { due = t; next = sources[i]; }
+  }
+  return next;
+}
+
+void Clock::runEvent(ClockEventSource* source, uint64_t due) {
+  if (due > virtual_nanos) virtual_nanos = due; // A late event runs now, as a held-off interrupt would
+  in_event = true;
+  event_count++;
+  source->handleEvent(virtual_nanos);
+  in_event = false;
+}
+
+void Clock::advance(uint64_t ns) {
+  const uint64_t target = virtual_nanos + ns;
+  if (!in_event) for (;;) {
+    uint64_t due;
+    ClockEventSource* source = nextSource(due);
+    if (!source || due > target) break;
+    runEvent(source, due);
+  }
+  if (target > virtual_nanos) virtual_nanos = target;
+}
+
+void Clock::runNextEvent() {
+  if (in_event) return;
+  uint64_t due;
+  ClockEventSource* source = nextSource(due);
+  if (source) runEvent(source, due);
+}
+
 #endif // __PLAT_LINUX__
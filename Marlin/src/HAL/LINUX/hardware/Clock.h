@@ -21,11 +21,43 @@
  */
 #pragma once
 
+#include <stdint.h>
 #include <chrono>
 #include <thread>
 
+/**
+ * Anything that wants to be woken by the virtual clock.
+ * nextEvent() returns the absolute time (in nanos) of the next event, or Clock::NEVER.
+ */
+class ClockEventSource {
+public:
+  virtual ~ClockEventSource() {};
+  virtual uint64_t nextEvent() = 0;
+  virtual void handleEvent(uint64_t now) = 0;
+};
+
+/**
+ * A fixed-rate event, e.g. to poll simulated hardware on the virtual clock
+ */
+class PeriodicEvent: public ClockEventSource {
+public:
+  typedef void (callback_fn)();
+
+  PeriodicEvent(uint64_t period_ns, callback_fn* fn) : period(period_ns), due(period_ns), cbfn(fn), active(true) {}
+  uint64_t nextEvent();
+  void handleEvent(uint64_t now) { due += period; cbfn(); }
+  void stop() { active = false; }
+
+private:
+  uint64_t period, due;
+  callback_fn* cbfn;
+  bool active;
+};
+
 class Clock {
 public:
+  static constexpr uint64_t NEVER = UINT64_MAX;
+
   static uint64_t ticks(uint32_t frequency = Clock::frequency) {
     return (Clock::nanos() - Clock::startup.count()) / (1000000000ULL / frequency);
   }
@@ -36,6 +68,7 @@ public:
 
   // Time acceleration compensated
   static uint64_t ticksToNanos(uint64_t tick, uint32_t frequency = Clock::frequency) {
+    if (Clock::virtual_time) return tick * (1000000000ULL / frequency);
     return (tick * (1000000000ULL / frequency)) / Clock::time_multiplier;
   }
 
@@ -45,6 +78,7 @@ public:
 
   // Time Acceleration compensated
   static uint64_t nanos() {
+    if (Clock::virtual_time) return Clock::virtual_nanos;
     auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
     return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
   }
@@ -62,18 +96,22 @@ public:
   }
 
   static void delayCycles(uint64_t cycles) {
+    if (Clock::virtual_time) return Clock::advance((1000000000L / frequency) * cycles);
     std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
   }
 
   static void delayMicros(uint64_t micros) {
+    if (Clock::virtual_time) return Clock::advance(micros * 1000ULL);
     std::this_thread::sleep_for(std::chrono::microseconds( micros ) / Clock::time_multiplier);
   }
 
   static void delayMillis(uint64_t millis) {
+    if (Clock::virtual_time) return Clock::advance(millis * 1000000ULL);
     std::this_thread::sleep_for(std::chrono::milliseconds( millis ) / Clock::time_multiplier);
   }
 
   static void delaySeconds(double secs) {
+    if (Clock::virtual_time) return Clock::advance(secs * 1000000000.0);
     std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
   }
 
@@ -82,8 +120,54 @@ public:
     Clock::time_multiplier = tm;
   }
 
+  /**
+   * Virtual time: a discrete-event clock that only moves when the simulation moves it.
+   * Attached event sources (timers, simulated hardware, serial) are run in order of due time,
+   * ties resolved in order of attachment, so a run is repeatable and not bound to wall-clock time.
+   * Must be selected before any timer is initialized. The time multiplier is ignored.
+   */
+  static void setVirtualTime(bool vt) {
+    Clock::virtual_time = vt;
+  }
+
+  static bool isVirtualTime() {
+    return Clock::virtual_time;
+  }
+
+  static bool inEvent() {
+    return Clock::in_event;
+  }
+
+  static void attach(ClockEventSource* source);
+
+  // Move the virtual clock forward, running every event that falls due on the way.
+  // Called from inside an event handler, time passes but nothing else runs (like an ISR).
+  static void advance(uint64_t ns);
+
+  // Jump straight to the next due event and run it. Used where the firmware is idle.
+  static void runNextEvent();
+
+  // Number of events run on the virtual clock
+  static uint64_t eventCount() {
+    return Clock::event_count;
+  }
+
 private:
+  static ClockEventSource* nextSource(uint64_t &due);
+  static void runEvent(ClockEventSource* source, uint64_t due);
+
   static std::chrono::nanoseconds startup;
   static uint32_t frequency;
   static double time_multiplier;
+
+  static bool virtual_time, in_event;
+  static uint64_t virtual_nanos, event_count;
+  static constexpr uint8_t max_sources = 8;
+  static ClockEventSource* sources[max_sources];
+  static uint8_t source_count;
 };
+
+inline uint64_t PeriodicEvent::nextEvent() {
+  if (!active) return Clock::NEVER;
+  return due;
+}
@@ -51,6 +51,8 @@ class IOLogger {
 public:
   virtual ~IOLogger(){};
   virtual void log(GpioEvent ev) = 0;
+  // A sample of a simulated physical quantity, e.g. a heater temperature
+  virtual void log(uint64_t timestamp, const char *source, const char *quantity, double value) {};
 };
 
 class Peripheral {
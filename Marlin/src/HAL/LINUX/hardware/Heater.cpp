@@ -22,34 +22,54 @@
 #ifdef __PLAT_LINUX__
 
 #include "Clock.h"
-#include <stdio.h>
+#include <math.h>
+#include <random>
 #include "../../../inc/MarlinConfig.h"
 
 #include "Heater.h"
 
-Heater::Heater(pin_t heater, pin_t adc) {
-  heater_state = 0;
-  room_temp_raw = 150;
-  last = Clock::micros();
-  heater_pin = heater;
-  adc_pin = adc;
-  heat = 0.0;
+#define LOG_INTERVAL_NS 100000000ULL // Log the plant state every 100ms
+
+Heater::Heater(pin_t heater, pin_t adc, const ThermalModel &model, IOLogger *plant_log/*=nullptr*/, const char *name/*=nullptr*/)
+  : heater_pin(heater), adc_pin(adc), model(model), plant_log(plant_log), name(name) {
+  temperature = sensor_temp = model.ambient;
+  energy = 0.0;
+  last = next_log = Clock::nanos();
+  Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = this->adc(sensor_temp) << 2;
 }
 
 Heater::~Heater() {
 }
 
+uint16_t Heater::adc(const double celsius) {
+  static std::minstd_rand noise_source;
+  const double r = model.r25 * exp(model.beta * (1.0 / (celsius + 273.15) - 1.0 / 298.15)),
+               counts = 1023.0 * r / (r + model.pullup)
+                      + (model.noise ? model.noise * (2.0 * noise_source() / noise_source.max() - 1.0) : 0.0);
+  return (uint16_t)constrain(lround(counts), 0, 1023);
+}
+
 void Heater::update() {
-  // crude pwm read and cruder heat simulation
-  auto now = Clock::micros();
-  double delta = (now - last);
-  if (delta > 1000 ) {
-    heater_state = pwmcap.update(0xFFFF * Gpio::pin_map[heater_pin].value);
-    last = now;
-    heat += (heater_state - heat) * (delta / 1000000000.0);
-
-    NOLESS(heat, room_temp_raw);
-    Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = 0xFFFF - (uint16_t)heat;
+  // Heater output since the last update, from the pin state or its PWM value
+  const uint64_t now = Clock::nanos();
+  if (now - last < 100000) return;
+  const double dt = (now - last) / 1000000000.0;
+  last = now;
+
+  const uint16_t pin = Gpio::pin_map[heater_pin].value;
+  const double power = model.heater_power * (pin > 1 ? pin / 255.0 : pin);
+  energy += power * dt;
+
+  // The heated mass gains heater power and loses heat to the room. The sensor follows it.
+  temperature += (power - (temperature - model.ambient) * model.convection) * dt / model.heat_capacity;
+  sensor_temp += (temperature - sensor_temp) * (1.0 - exp(-dt / model.sensor_lag));
+  Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = adc(sensor_temp) << 2;
+
+  if (plant_log && now >= next_log) {
+    plant_log->log(now, name, "temperature", temperature);
+    plant_log->log(now, name, "sensor", sensor_temp);
+    plant_log->log(now, name, "energy", energy);
+    next_log += LOG_INTERVAL_NS;
   }
 }
 
@@ -23,25 +23,38 @@
 
 #include "Gpio.h"
 
-struct LowpassFilter {
-  uint64_t data_delay = 0;
-  uint16_t update(uint16_t value) {
-    data_delay = data_delay - (data_delay >> 6) + value;
-    return (uint16_t)(data_delay >> 6);
-  }
+/**
+ * Physical constants of a heater, the mass it heats and its thermistor
+ */
+struct ThermalModel {
+  double heater_power,    // (W) Power with the heater fully on
+         heat_capacity,   // (J/K) Heat to raise the heated mass by one degree
+         convection,      // (W/K) Heat lost to the room per degree above ambient
+         ambient,         // (°C) Room temperature
+         sensor_lag,      // (s) Time constant of the sensor following the heated mass
+         beta,            // (K) Thermistor beta coefficient
+         r25,             // (Ω) Thermistor resistance at 25°C
+         pullup,          // (Ω) Pullup resistor of the thermistor divider
+         noise;           // (ADC counts) Peak noise added to each reading
 };
 
 class Heater: public Peripheral {
 public:
-  Heater(pin_t heater, pin_t adc);
+  Heater(pin_t heater, pin_t adc, const ThermalModel &model, IOLogger *plant_log=nullptr, const char *name=nullptr);
   virtual ~Heater();
   void interrupt(GpioEvent ev);
   void update();
 
+  // 10-bit ADC reading of the thermistor divider at a given temperature
+  uint16_t adc(const double celsius);
+
   pin_t heater_pin, adc_pin;
-  uint16_t room_temp_raw;
-  uint16_t heater_state;
-  LowpassFilter pwmcap;
-  double heat;
-  uint64_t last;
+  ThermalModel model;
+  double temperature,     // (°C) Heated mass
+         sensor_temp,     // (°C) Thermistor, lagging behind
+         energy;          // (J) Total heater output, for power averages
+  uint64_t last, next_log;
+
+  IOLogger *plant_log;
+  const char *name;
 };
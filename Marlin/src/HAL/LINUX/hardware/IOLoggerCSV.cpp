@@ -36,12 +36,21 @@ void IOLoggerCSV::log(GpioEvent ev) {
   events.push_back(ev); //minimal impact to signal handler
 }
 
+void IOLoggerCSV::log(uint64_t timestamp, const char *source, const char *quantity, double value) {
+  std::lock_guard<std::mutex> lock(vector_lock);
+  samples.push_back({ timestamp, source, quantity, value });
+}
+
 void IOLoggerCSV::flush() {
   { std::lock_guard<std::mutex> lock(vector_lock);
     while (!events.empty()) {
       file << events.front().timestamp << ", "<< events.front().pin_id << ", " << events.front().event << std::endl;
       events.pop_front();
     }
+    while (!samples.empty()) {
+      file << samples.front().timestamp << ", " << samples.front().source << ", " << samples.front().quantity << ", " << samples.front().value << std::endl;
+      samples.pop_front();
+    }
   }
   file.flush();
 }
@@ -32,9 +32,17 @@ public:
   virtual ~IOLoggerCSV();
   void flush();
   void log(GpioEvent ev);
+  void log(uint64_t timestamp, const char *source, const char *quantity, double value);
 
 private:
+  struct Sample {
+    uint64_t timestamp;
+    const char *source, *quantity;
+    double value;
+  };
+
   std::ofstream file;
   std::list<GpioEvent> events;
+  std::list<Sample> samples;
   std::mutex vector_lock;
 };
@@ -21,45 +21,88 @@
  */
 #ifdef __PLAT_LINUX__
 
-#include <random>
+#include <math.h>
 #include <stdio.h>
 #include "Clock.h"
 #include "LinearAxis.h"
 
-LinearAxis::LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max) {
+#define REST_NS 50000000ULL       // Steps further apart than 50ms start from rest
+#define LOG_INTERVAL_NS 10000000ULL // Log the position at most every 10ms
+
+LinearAxis::LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max, const AxisModel &model, IOLogger *plant_log/*=nullptr*/, const char *name/*=nullptr*/)
+  : model(model), plant_log(plant_log), name(name) {
   enable_pin = enable;
   dir_pin = dir;
   step_pin = step;
   min_pin = end_min;
   max_pin = end_max;
 
-  min_position = 50;
-  max_position = (200*80) + min_position;
-  position = rand() % ((max_position - 40) - min_position) + (min_position + 20);
-  last_update = Clock::nanos();
+  position = logged_position = lround(model.start * model.steps_per_mm);
+  lost_steps = logged_lost_steps = 0;
+  direction = 0;
+  step_index = 0;
+  last_update = next_log = Clock::nanos();
+  update_endstops();
 
   Gpio::attachPeripheral(step_pin, this);
-
 }
 
 LinearAxis::~LinearAxis() {
 
 }
 
-void LinearAxis::update() {
+void LinearAxis::update_endstops() {
+  const double mm = position / model.steps_per_mm;
+  if (Gpio::valid_pin(min_pin)) Gpio::pin_map[min_pin].value = (mm <= model.min_endstop) != model.min_inverting;
+  if (Gpio::valid_pin(max_pin)) Gpio::pin_map[max_pin].value = (mm >= model.max_endstop) != model.max_inverting;
+}
 
+void LinearAxis::update() {
+  if (!plant_log || Clock::nanos() < next_log) return;
+  next_log = Clock::nanos() + LOG_INTERVAL_NS;
+  if (position != logged_position) plant_log->log(last_update, name, "position", position / model.steps_per_mm);
+  if (lost_steps != logged_lost_steps) plant_log->log(last_update, name, "lost_steps", lost_steps);
+  logged_position = position;
+  logged_lost_steps = lost_steps;
 }
 
 void LinearAxis::interrupt(GpioEvent ev) {
-  if (ev.pin_id == step_pin && !Gpio::pin_map[enable_pin].value){
-    if (ev.event == GpioEvent::RISE) {
-      last_update = ev.timestamp;
-      position += -1 + 2 * Gpio::pin_map[dir_pin].value;
-      Gpio::pin_map[min_pin].value = (position < min_position);
-      //Gpio::pin_map[max_pin].value = (position > max_position);
-      //if (position < min_position) printf("axis(%d) endstop : pos: %d, mm: %f, min: %d\n", step_pin, position, position / 80.0, Gpio::pin_map[min_pin].value);
-    }
+  if (ev.pin_id != step_pin || ev.event != GpioEvent::RISE) return;
+  if (Gpio::pin_map[enable_pin].value != model.enable_on) return;
+
+  const int8_t dir = (Gpio::pin_map[dir_pin].value != 0) != model.invert_dir ? 1 : -1;
+  const uint64_t now = ev.timestamp;
+  constexpr uint8_t ring = 2 * step_window;
+
+  // Starting out or reversing: pretend the recent steps were long ago, at rest
+  if (dir != direction || now - step_time[(step_index + ring - 1) % ring] > REST_NS) {
+    for (uint8_t i = 0; i < ring; i++) step_time[(step_index + i) % ring] = now - REST_NS * (ring - i);
+    for (uint8_t i = 0; i < step_window; i++) step_speed[i] = 0;
+    direction = dir;
+  }
+
+  // Speed over the last few steps, and the change from the window before
+  const uint64_t window_start = step_time[(step_index + step_window) % ring],
+                 prev_window_start = step_time[step_index];
+  const double window = (now - window_start) / 1000000000.0,
+               speed = step_window / (model.steps_per_mm * window),
+               accel = (speed - step_speed[step_index % step_window]) * 2000000000.0 / (now - prev_window_start);
+
+  step_time[step_index] = now;
+  step_speed[step_index % step_window] = speed;
+  step_index = (step_index + 1) % ring;
+
+  // Too fast for the driver, or more force than the motor has, and the step is lost
+  if ((model.max_step_rate && step_window / window > model.max_step_rate)
+    || (model.mass && fabs(accel) * 0.001 * model.mass > model.max_force)
+  ) {
+    lost_steps++;
+    return;
   }
+
+  last_update = now;
+  position += dir;
+  update_endstops();
 }
 
 #endif // __PLAT_LINUX__
@@ -24,22 +24,54 @@
 #include <chrono>
 #include "Gpio.h"
 
+/**
+ * Physical constants of a stepper-driven axis and its endstops
+ */
+struct AxisModel {
+  double steps_per_mm,
+         start,           // (mm) Position at power-up
+         min_endstop,     // (mm) Where the min endstop triggers, NAN for none
+         max_endstop,     // (mm) Where the max endstop triggers, NAN for none
+         max_step_rate,   // (steps/s) Steps arriving faster are lost. 0 for no limit.
+         mass,            // (kg) Moving mass. 0 for no limit on acceleration.
+         max_force;       // (N) Force the motor gives before it skips
+  bool invert_dir,        // Motor wiring, as INVERT_*_DIR
+       enable_on,         // Enable pin level that powers the motor, as *_ENABLE_ON
+       min_inverting,     // Endstop pin levels, as *_ENDSTOP_INVERTING
+       max_inverting;
+};
+
 class LinearAxis: public Peripheral {
 public:
-  LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max);
+  LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max, const AxisModel &model, IOLogger *plant_log=nullptr, const char *name=nullptr);
   virtual ~LinearAxis();
   void update();
   void interrupt(GpioEvent ev);
 
+  // Measure speed over several steps so timer jitter and multi-stepping bursts aren't taken for high speed
+  static constexpr uint8_t step_window = 16;
+
   pin_type enable_pin;
   pin_type dir_pin;
   pin_type step_pin;
   pin_type min_pin;
   pin_type max_pin;
 
+  AxisModel model;
   int32_t position;
-  int32_t min_position;
-  int32_t max_position;
-  uint64_t last_update;
+  uint32_t lost_steps;
+  uint64_t last_update, next_log;
+
+  IOLogger *plant_log;
+  const char *name;
+
+private:
+  void update_endstops();
 
+  int8_t direction;
+  uint8_t step_index;
+  uint64_t step_time[2 * step_window];  // When recent steps arrived
+  double step_speed[step_window];       // (mm/s) Speed over the window ending at each recent step
+  int32_t logged_position;
+  uint32_t logged_lost_steps;
 };
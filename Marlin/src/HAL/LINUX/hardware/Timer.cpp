@@ -37,7 +37,7 @@ Timer::Timer() {
 }
 
 Timer::~Timer() {
-  timer_delete(timerid);
+  if (!Clock::isVirtualTime()) timer_delete(timerid);
 }
 
 void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
@@ -47,6 +47,11 @@ void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
   frequency = sim_freq;
   cbfn = fn;
 
+  if (Clock::isVirtualTime()) {
+    Clock::attach(this);
+    return;
+  }
+
   sa.sa_flags = SA_SIGINFO;
   sa.sa_sigaction = Timer::handler;
   sigemptyset(&sa.sa_mask);
@@ -73,6 +78,7 @@ void Timer::start(uint32_t frequency) {
 }
 
 void Timer::enable() {
+  if (Clock::isVirtualTime()) { active = true; return; }
   if (sigprocmask(SIG_UNBLOCK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -81,6 +87,7 @@ void Timer::enable() {
 }
 
 void Timer::disable() {
+  if (Clock::isVirtualTime()) { active = false; return; }
   if (sigprocmask(SIG_SETMASK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -88,6 +95,13 @@ void Timer::disable() {
 }
 
 void Timer::setCompare(uint32_t compare) {
+  if (Clock::isVirtualTime()) {
+    // The count restarts on each compare match, so inside the ISR the period runs from the match
+    this->compare = compare;
+    this->period = Clock::ticksToNanos(compare, frequency);
+    if (!Clock::inEvent()) this->start_time = Clock::nanos();
+    return;
+  }
   uint32_t nsec_offset = 0;
   if (active) {
     nsec_offset = Clock::nanos() - this->start_time; // calculate how long the timer would have been running for
@@ -111,7 +125,19 @@ void Timer::setCompare(uint32_t compare) {
 }
 
 uint32_t Timer::getCount() {
+  // Reading the counter costs a tick, so code polling it for a pulse width still sees time pass
+  if (Clock::isVirtualTime()) Clock::advance(Clock::ticksToNanos(1, frequency));
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
 
+uint64_t Timer::nextEvent() {
+  if (!active || !period) return Clock::NEVER;
+  return start_time + period;
+}
+
+void Timer::handleEvent(uint64_t now) {
+  start_time += period;
+  cbfn();
+}
+
 #endif // __PLAT_LINUX__
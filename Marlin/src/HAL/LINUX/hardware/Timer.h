@@ -30,7 +30,7 @@
 
 #include "Clock.h"
 
-class Timer {
+class Timer: public ClockEventSource {
 public:
   Timer();
   virtual ~Timer();
@@ -62,6 +62,10 @@ public:
                                                          // using a realtime linux kernel would help somewhat
   }
 
+  // Virtual time: the compare match is an event on the virtual clock
+  uint64_t nextEvent();
+  void handleEvent(uint64_t now);
+
 private:
   bool active;
   uint32_t compare;
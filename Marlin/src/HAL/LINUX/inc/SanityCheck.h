@@ -37,3 +37,7 @@
 #if HAS_TMC_SW_SERIAL
   #error "TMC220x Software Serial is not supported on this platform."
 #endif
+
+#if defined(SERIAL_DROP_AUTO_REPORTS) && SERIAL_DROP_AUTO_REPORTS >= 128
+  #error "SERIAL_DROP_AUTO_REPORTS must be less than 128 on LINUX."
+#endif
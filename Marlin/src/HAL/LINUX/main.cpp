@@ -35,6 +35,25 @@ extern void loop();
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
 
+//#define VIRTUAL_TIME // Run on a deterministic discrete-event clock instead of wall-clock time (see Clock.h)
+//#define GPIO_LOGGING // Full GPIO and Positional Logging
+//#define PLANT_LOGGING // Log the simulated heater temperatures and axis positions to plant_log.csv
+
+/**
+ * Physical models of the simulated printer. The axes follow the machine configuration.
+ * Edit these to study a particular heater, thermistor or moving mass.
+ *
+ *                          Power  J/K    W/K    Ambient Lag  Beta  R25     Pullup Noise
+ */
+#define SIM_HOTEND_MODEL  {  40.0,  16.7, 0.068, 25.0,   4.5, 4092, 100000, 4700,  1.0 }
+#define SIM_BED_MODEL     { 250.0, 900.0, 1.2,   25.0,  10.0, 4092, 100000, 4700,  1.0 }
+
+//                          Max steps/s  kg    N
+#define SIM_X_DYNAMICS    {  100000,     0.5,  30 }
+#define SIM_Y_DYNAMICS    {  100000,     1.0,  30 }
+#define SIM_Z_DYNAMICS    {  100000,     3.0, 300 } // Leadscrew
+#define SIM_E_DYNAMICS    {  100000,     0,     0 }
+
 // simple stdout / stdin implementation for fake serial port
 void write_serial_thread() {
   for (;;) {
@@ -56,28 +75,32 @@ void read_serial_thread() {
   }
 }
 
-void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
-  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
-  LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
-  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
-  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
-
-  //#define GPIO_LOGGING // Full GPIO and Positional Logging
-
-  #ifdef GPIO_LOGGING
-    IOLoggerCSV logger("all_gpio_log.csv");
-    Gpio::attachLogger(&logger);
-
-    std::ofstream position_log;
-    position_log.open("axis_position_log.csv");
-
-    int32_t x,y,z;
-  #endif
-
-  for (;;) {
+static constexpr float sim_steps_per_mm[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+static constexpr double sim_dynamics[][3] = { SIM_X_DYNAMICS, SIM_Y_DYNAMICS, SIM_Z_DYNAMICS, SIM_E_DYNAMICS };
+
+#if HAS_BED_PROBE && ENABLED(Z_MIN_PROBE_USES_Z_MIN_ENDSTOP_PIN)
+  // The probe on Z_MIN triggers with the nozzle still above the bed
+  static constexpr float sim_probe_offset[] = NOZZLE_TO_PROBE_OFFSET;
+  #define SIM_Z_MIN_ENDSTOP -sim_probe_offset[Z_AXIS]
+#else
+  #define SIM_Z_MIN_ENDSTOP Z_MIN_POS
+#endif
+
+// Axes start mid-travel with an endstop at each end
+#define _SIM_AXIS_MODEL(A,I,MIN_ES) { sim_steps_per_mm[I], (A##_MIN_POS + A##_MAX_POS) / 2.0, MIN_ES, A##_MAX_POS, \
+  sim_dynamics[I][0], sim_dynamics[I][1], sim_dynamics[I][2], INVERT_##A##_DIR, A##_ENABLE_ON, A##_MIN_ENDSTOP_INVERTING, A##_MAX_ENDSTOP_INVERTING }
+#define SIM_AXIS_MODEL(A,I) _SIM_AXIS_MODEL(A,I,A##_MIN_POS)
+
+class Simulation {
+public:
+  Simulation() {
+    #ifdef GPIO_LOGGING
+      Gpio::attachLogger(&logger);
+      position_log.open("axis_position_log.csv");
+    #endif
+  }
 
+  void update() {
     hotend.update();
     bed.update();
 
@@ -98,14 +121,80 @@ void simulation_loop() {
       // flush the logger
       logger.flush();
     #endif
+    #ifdef PLANT_LOGGING
+      plant_log.flush();
+    #endif
+  }
 
+private:
+  #ifdef PLANT_LOGGING
+    IOLoggerCSV plant_log{"plant_log.csv"};
+    #define PLANT_LOG(NAME) &plant_log, NAME
+  #else
+    #define PLANT_LOG(NAME) nullptr, NAME
+  #endif
+
+  Heater hotend{HEATER_0_PIN, TEMP_0_PIN, SIM_HOTEND_MODEL, PLANT_LOG("hotend")};
+  Heater bed{HEATER_BED_PIN, TEMP_BED_PIN, SIM_BED_MODEL, PLANT_LOG("bed")};
+  LinearAxis x_axis{X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN, SIM_AXIS_MODEL(X, X_AXIS), PLANT_LOG("x")};
+  LinearAxis y_axis{Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN, SIM_AXIS_MODEL(Y, Y_AXIS), PLANT_LOG("y")};
+  LinearAxis z_axis{Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN, _SIM_AXIS_MODEL(Z, Z_AXIS, SIM_Z_MIN_ENDSTOP), PLANT_LOG("z")};
+  LinearAxis extruder0{E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC,
+    { sim_steps_per_mm[E_AXIS], 0, NAN, NAN, sim_dynamics[E_AXIS][0], sim_dynamics[E_AXIS][1], sim_dynamics[E_AXIS][2], INVERT_E0_DIR, E_ENABLE_ON, false, false },
+    PLANT_LOG("e0")
+  };
+
+  #ifdef GPIO_LOGGING
+    IOLoggerCSV logger{"all_gpio_log.csv"};
+    std::ofstream position_log;
+    int32_t x = 0, y = 0, z = 0;
+  #endif
+};
+
+void simulation_loop() {
+  Simulation sim;
+  for (;;) {
+    sim.update();
     std::this_thread::yield();
   }
 }
 
+#ifdef VIRTUAL_TIME
+
+  /**
+   * On the virtual clock the simulated hardware is polled at a fixed rate and the host
+   * delivers one byte per character time at BAUDRATE. Reading stdin blocks, so time stands
+   * still while the host is silent and a piped G-code file always replays identically.
+   */
+  #define SIMULATION_TICK_NS 100000ULL
+  #define SERIAL_CHAR_NS     (1000000000ULL * 10 / (BAUDRATE))
+
+  Simulation *virtual_simulation;
+
+  void simulation_event() { virtual_simulation->update(); }
+
+  void read_serial_event();
+  PeriodicEvent simulation_tick(SIMULATION_TICK_NS, simulation_event);
+  PeriodicEvent serial_rx(SERIAL_CHAR_NS, read_serial_event);
+
+  void read_serial_event() {
+    if (!usb_serial.receive_buffer.free()) return;
+    const int c = fgetc(stdin);
+    if (c == EOF)
+      serial_rx.stop();
+    else
+      usb_serial.receive_buffer.write(c);
+  }
+
+#endif
+
 int main() {
   std::thread write_serial (write_serial_thread);
-  std::thread read_serial (read_serial_thread);
+  #ifdef VIRTUAL_TIME
+    Clock::setVirtualTime(true);
+  #else
+    std::thread read_serial (read_serial_thread);
+  #endif
 
   #ifdef MYSERIAL0
     MYSERIAL0.begin(BAUDRATE);
@@ -118,19 +207,30 @@ int main() {
 
   HAL_timer_init();
 
-  std::thread simulation (simulation_loop);
+  #ifdef VIRTUAL_TIME
+    Simulation simulation;
+    virtual_simulation = &simulation;
+    Clock::attach(&simulation_tick);
+    Clock::attach(&serial_rx);
+  #else
+    std::thread simulation (simulation_loop);
+  #endif
 
   DELAY_US(10000);
 
   setup();
   for (;;) {
     loop();
-    std::this_thread::yield();
+    #ifndef VIRTUAL_TIME
+      std::this_thread::yield();
+    #endif
   }
 
-  simulation.join();
+  #ifndef VIRTUAL_TIME
+    simulation.join();
+    read_serial.join();
+  #endif
   write_serial.join();
-  read_serial.join();
 }
 
 #endif // __PLAT_LINUX__
@@ -88,7 +88,9 @@
   #define EMPTY_UINT8             ((uint8_t)-1)
 
   static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4))) = {0};
-  static int current_slot = -1;
+  #if DISABLED(FLASH_EEPROM_LOG)
+    static int current_slot = -1;
+  #endif
 
   static_assert(0 == MARLIN_EEPROM_SIZE % 4, "MARLIN_EEPROM_SIZE must be a multiple of 4"); // Ensure copying as uint32_t is safe
   static_assert(0 == FLASH_UNIT_SIZE % MARLIN_EEPROM_SIZE, "MARLIN_EEPROM_SIZE must divide evenly into your FLASH_UNIT_SIZE");
@@ -96,8 +98,194 @@
   static_assert(IS_FLASH_SECTOR(FLASH_SECTOR), "FLASH_SECTOR is invalid");
   static_assert(IS_POWER_OF_2(FLASH_UNIT_SIZE), "FLASH_UNIT_SIZE should be a power of 2, please check your chip's spec sheet");
 
+  static bool erase_sector() {
+    FLASH_EraseInitTypeDef EraseInitStruct;
+    uint32_t SectorError = 0;
+
+    EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
+    EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    EraseInitStruct.Sector = FLASH_SECTOR;
+    EraseInitStruct.NbSectors = 1;
+
+    PAUSE_SERVO_OUTPUT();
+    DISABLE_ISRS();
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
+    ENABLE_ISRS();
+    RESUME_SERVO_OUTPUT();
+    if (status != HAL_OK) {
+      DEBUG_ECHOLNPAIR("HAL_FLASHEx_Erase=", status);
+      DEBUG_ECHOLNPAIR("GetError=", HAL_FLASH_GetError());
+      DEBUG_ECHOLNPAIR("SectorError=", SectorError);
+      return false;
+    }
+    return true;
+  }
+
 #endif
 
+#if ENABLED(FLASH_EEPROM_LOG)
+
+  /**
+   * Keep the EEPROM image as a log of records in the flash sector, so a save
+   * only has to program the words that changed. Each record is a header word
+   * (word offset << 16 | word count), the data words, and a check word. Each
+   * save ends with a commit word (0xFFFF << 16 | words in the save), and its
+   * records are only replayed once that is seen and all of them check out,
+   * so a save cut short by power loss leaves the previous settings intact.
+   * The sector is only erased when the log is full, and then the whole image
+   * is written back as a single save.
+   */
+  #define LOG_WORDS               ((MARLIN_EEPROM_SIZE) / sizeof(uint32_t))
+  #define LOG_END                 (FLASH_ADDRESS_END + 1)
+  #define LOG_CHECK(CRC)          (0xA5A50000UL | (CRC))
+  #define LOG_COMMIT(W)           (0xFFFF0000UL | (W))  // No record has a word offset of 0xFFFF
+  #define IS_LOG_COMMIT(H)        ((H) >> 16 == 0xFFFF)
+  #define LOG_DIRTY(W)            TEST32(dirty_words[(W) / 32], (W) % 32)
+
+  static_assert(LOG_WORDS < 0xFFFF, "MARLIN_EEPROM_SIZE is too large for FLASH_EEPROM_LOG");
+  static_assert((FLASH_UNIT_SIZE) / sizeof(uint32_t) < 0xFFFF, "FLASH_UNIT_SIZE is too large for FLASH_EEPROM_LOG");
+
+  static uint32_t log_address;                        // Where the next record goes. LOG_END when the log must be compacted.
+  static uint32_t dirty_words[(LOG_WORDS + 31) / 32]; // Words of ram_eeprom changed since the last save
+
+  static uint16_t log_crc(const uint32_t header, const uint8_t *data, const uint16_t count) {
+    uint16_t crc = 0;
+    crc16(&crc, &header, sizeof(header));
+    crc16(&crc, data, count * sizeof(uint32_t));
+    return crc;
+  }
+
+  // Check the records of one save, from start up to its commit word at end, and apply them if asked
+  static bool log_walk(const uint32_t start, const uint32_t end, const bool apply) {
+    uint32_t address = start;
+    while (address < end) {
+      const uint32_t header = *(__IO uint32_t*)address;
+      const uint16_t offset = header >> 16, count = header & 0xFFFF;
+      const uint32_t check_address = address + (1 + count) * sizeof(uint32_t);
+      if (!count || offset + count > LOG_WORDS || check_address >= end) return false;
+
+      const uint8_t * const data = (uint8_t*)(address + sizeof(uint32_t));
+      if (*(__IO uint32_t*)check_address != LOG_CHECK(log_crc(header, data, count))) return false;
+      if (apply) memcpy(ram_eeprom + offset * sizeof(uint32_t), data, count * sizeof(uint32_t));
+      address = check_address + sizeof(uint32_t);
+    }
+    return address == end;
+  }
+
+  // Rebuild ram_eeprom from the committed saves in the log, and find the end of the log
+  static void log_replay() {
+    for (int i = 0; i < MARLIN_EEPROM_SIZE; i++) ram_eeprom[i] = EMPTY_UINT8;
+
+    uint32_t address = FLASH_ADDRESS_START;
+    uint16_t saves = 0;
+    while (address < LOG_END) {
+      const uint32_t header = *(__IO uint32_t*)address;
+      if (header == EMPTY_UINT32) break;
+
+      if (IS_LOG_COMMIT(header)) {
+        // Apply the save only if every one of its records is intact
+        const uint32_t size = (header & 0xFFFF) * sizeof(uint32_t);
+        if (size <= address - (FLASH_ADDRESS_START) && log_walk(address - size, address, false)) {
+          log_walk(address - size, address, true);
+          saves++;
+        }
+        address += sizeof(uint32_t);
+        continue;
+      }
+
+      const uint16_t offset = header >> 16, count = header & 0xFFFF;
+      const uint32_t check_address = address + (1 + count) * sizeof(uint32_t);
+      if (!count || offset + count > LOG_WORDS || check_address >= LOG_END) {
+        DEBUG_ECHOLNPAIR("Bad EEPROM log header at ", address);
+        address = LOG_END;
+        break;
+      }
+      address = check_address + sizeof(uint32_t);  // Checked when its save is committed
+    }
+
+    // Appending needs the rest of the sector to be erased
+    for (uint32_t a = address; a < LOG_END; a += sizeof(uint32_t))
+      if (*(__IO uint32_t*)a != EMPTY_UINT32) { address = LOG_END; break; }
+
+    log_address = address;
+    ZERO(dirty_words);
+    DEBUG_ECHOLNPAIR("EEPROM log replayed ", saves, " saves. Used ", address - (FLASH_ADDRESS_START), " bytes.");
+  }
+
+  static bool log_program(uint32_t &address, const uint32_t data) {
+    const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address, data);
+    if (status != HAL_OK) {
+      DEBUG_ECHOLNPAIR("HAL_FLASH_Program=", status);
+      DEBUG_ECHOLNPAIR("GetError=", HAL_FLASH_GetError());
+      DEBUG_ECHOLNPAIR("address=", address);
+      return false;
+    }
+    address += sizeof(uint32_t);
+    return true;
+  }
+
+  // Append a record for count words of ram_eeprom from the given word offset
+  static bool log_append(const uint16_t offset, const uint16_t count) {
+    const uint8_t * const data = ram_eeprom + offset * sizeof(uint32_t);
+    const uint32_t header = uint32_t(offset) << 16 | count;
+    uint32_t address = log_address;
+    bool success = log_program(address, header);
+    for (uint16_t i = 0; success && i < count; i++) {
+      uint32_t word;
+      memcpy(&word, data + i * sizeof(uint32_t), sizeof(uint32_t));
+      success = log_program(address, word);
+    }
+    if (success) success = log_program(address, LOG_CHECK(log_crc(header, data, count)));
+    log_address = success ? address : LOG_END;
+    return success;
+  }
+
+  // End the save that began at start, so it can be replayed
+  static bool log_commit(const uint32_t start) {
+    uint32_t address = log_address;
+    const bool success = log_program(address, LOG_COMMIT((log_address - start) / sizeof(uint32_t)));
+    log_address = success ? address : LOG_END;
+    return success;
+  }
+
+  // Find the next run of changed words at or after w, joining runs closer than a record's overhead
+  static bool log_next_run(uint16_t &w, uint16_t &count) {
+    while (w < LOG_WORDS && !LOG_DIRTY(w)) w++;
+    if (w >= LOG_WORDS) return false;
+    uint16_t end = w + 1;
+    for (uint16_t i = end; i < LOG_WORDS && i <= end + 2; i++) if (LOG_DIRTY(i)) end = i + 1;
+    count = end - w;
+    return true;
+  }
+
+  // Append the changed words, or start over with the whole image if they don't fit
+  static bool log_save() {
+    uint32_t needed = sizeof(uint32_t); // Commit word
+    for (uint16_t w = 0, n; log_next_run(w, n); w += n) needed += (n + 2) * sizeof(uint32_t);
+
+    const uint32_t start = log_address;
+    bool success = start + needed <= LOG_END;
+    for (uint16_t w = 0, n; success && log_next_run(w, n); w += n) success = log_append(w, n);
+    if (success) success = log_commit(start);
+
+    if (!success) {
+      DEBUG_ECHOLNPGM("EEPROM log full. Compacting.");
+      success = erase_sector();
+      if (success) {
+        log_address = FLASH_ADDRESS_START;
+        success = log_append(0, LOG_WORDS) && log_commit(FLASH_ADDRESS_START);
+      }
+    }
+
+    if (success) {
+      ZERO(dirty_words);
+      DEBUG_ECHOLNPAIR("EEPROM log saved. Used ", log_address - (FLASH_ADDRESS_START), " bytes.");
+    }
+    return success;
+  }
+
+#endif // FLASH_EEPROM_LOG
+
 static bool eeprom_data_written = false;
 
 #ifndef MARLIN_EEPROM_SIZE
@@ -107,7 +295,16 @@ size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
 
 bool PersistentStore::access_start() {
 
-  #if ENABLED(FLASH_EEPROM_LEVELING)
+  #if ENABLED(FLASH_EEPROM_LOG)
+
+    if (!log_address || eeprom_data_written) {
+      // First access since power on, or a write_data without access_finish
+      if (eeprom_data_written) DEBUG_ECHOLN("Dangling EEPROM write_data");
+      log_replay();
+      eeprom_data_written = false;
+    }
+
+  #elif ENABLED(FLASH_EEPROM_LEVELING)
 
     if (current_slot == -1 || eeprom_data_written) {
       // This must be the first time since power on that we have accessed the storage, or someone
@@ -153,34 +350,26 @@ bool PersistentStore::access_finish() {
       __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
     #endif
 
-    #if ENABLED(FLASH_EEPROM_LEVELING)
+    #if ENABLED(FLASH_EEPROM_LOG)
 
-      HAL_StatusTypeDef status = HAL_ERROR;
       bool flash_unlocked = false;
+      UNLOCK_FLASH();
+      const bool success = log_save();
+      LOCK_FLASH();
 
-      if (--current_slot < 0) {
-        // all slots have been used, erase everything and start again
+      if (success) eeprom_data_written = false;
+      return success;
 
-        FLASH_EraseInitTypeDef EraseInitStruct;
-        uint32_t SectorError = 0;
+    #elif ENABLED(FLASH_EEPROM_LEVELING)
 
-        EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
-        EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
-        EraseInitStruct.Sector = FLASH_SECTOR;
-        EraseInitStruct.NbSectors = 1;
+      HAL_StatusTypeDef status = HAL_ERROR;
+      bool flash_unlocked = false;
 
+      if (--current_slot < 0) {
+        // all slots have been used, erase everything and start again
         current_slot = EEPROM_SLOTS - 1;
         UNLOCK_FLASH();
-
-        PAUSE_SERVO_OUTPUT();
-        DISABLE_ISRS();
-        status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
-        ENABLE_ISRS();
-        RESUME_SERVO_OUTPUT();
-        if (status != HAL_OK) {
-          DEBUG_ECHOLNPAIR("HAL_FLASHEx_Erase=", status);
-          DEBUG_ECHOLNPAIR("GetError=", HAL_FLASH_GetError());
-          DEBUG_ECHOLNPAIR("SectorError=", SectorError);
+        if (!erase_sector()) {
           LOCK_FLASH();
           return false;
         }
@@ -246,6 +435,7 @@ bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, ui
     #if ENABLED(FLASH_EEPROM_LEVELING)
       if (v != ram_eeprom[pos]) {
         ram_eeprom[pos] = v;
+        TERN_(FLASH_EEPROM_LOG, SBI32(dirty_words[pos / 128], pos / 4 % 32));
         eeprom_data_written = true;
       }
     #else
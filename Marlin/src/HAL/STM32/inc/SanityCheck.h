@@ -49,8 +49,17 @@
   #error "FLASH_EEPROM_LEVELING is currently only supported on STM32F4 hardware."
 #endif
 
+#if ENABLED(FLASH_EEPROM_LOG) && DISABLED(FLASH_EEPROM_LEVELING)
+  #error "FLASH_EEPROM_LOG requires FLASH_EEPROM_LEVELING."
+#endif
+
 #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
   #error "SERIAL_STATS_MAX_RX_QUEUED is not supported on this platform."
 #elif ENABLED(SERIAL_STATS_DROPPED_RX)
   #error "SERIAL_STATS_DROPPED_RX is not supported on this platform."
 #endif
+
+// Hardware serial ports can only have SERIAL_TX_BUFFER_SIZE - 1 bytes free
+#if defined(SERIAL_DROP_AUTO_REPORTS) && (SERIAL_PORT >= 0 || (defined(SERIAL_PORT_2) && SERIAL_PORT_2 >= 0)) && SERIAL_DROP_AUTO_REPORTS >= SERIAL_TX_BUFFER_SIZE
+  #error "SERIAL_DROP_AUTO_REPORTS must be less than SERIAL_TX_BUFFER_SIZE (64 unless set in build_flags) on a hardware serial port."
+#endif
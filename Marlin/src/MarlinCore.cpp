@@ -85,6 +85,10 @@
   #include "feature/direct_stepping.h"
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+  #include "feature/input_shaping.h"
+#endif
+
 #if ENABLED(HOST_ACTION_COMMANDS)
   #include "feature/host_actions.h"
 #endif
@@ -221,6 +225,14 @@
   #include "feature/password/password.h"
 #endif
 
+#if ENABLED(MOTION_BENCHMARK)
+  #include "feature/benchmark.h"
+#endif
+
+#if ENABLED(EVENT_TRACE)
+  #include "feature/event_trace.h"
+#endif
+
 PGMSTR(NUL_STR, "");
 PGMSTR(M112_KILL_STR, "M112 Shutdown");
 PGMSTR(G28_STR, "G28");
@@ -693,6 +705,8 @@ inline void manage_inactivity(const bool ignore_stepper_queue=false) {
  */
 void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
 
+  TERN_(EVENT_TRACE, EVENT_TRACE_SCOPE(IDLE));
+
   // Core Marlin activities
   manage_inactivity(TERN_(ADVANCED_PAUSE_FEATURE, no_stepper_sleep));
 
@@ -729,6 +743,9 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Handle SD Card insert / remove
   TERN_(SDSUPPORT, card.manage_media());
 
+  // Prefetch the SD print file
+  TERN_(SD_READ_AHEAD, card.read_ahead());
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, Sd2Card::idle());
 
@@ -773,6 +790,9 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Direct Stepping
   TERN_(DIRECT_STEPPING, page_manager.write_responses());
 
+  // Report a full input shaping buffer
+  TERN_(INPUT_SHAPING, input_shaping.check_overflows());
+
   #if HAS_TFT_LVGL_UI
     LV_TASK_HANDLER();
   #endif
@@ -1288,6 +1308,8 @@ void setup() {
     SETUP_RUN(password.lock_machine());      // Will not proceed until correct password provided
   #endif
 
+  TERN_(MOTION_BENCHMARK, SETUP_RUN(motion_benchmark.reset()));
+
   marlin_state = MF_RUNNING;
 
   SETUP_LOG("setup() completed.");
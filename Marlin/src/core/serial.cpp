@@ -32,6 +32,31 @@ static PGMSTR(echomagic, "echo:");
   int8_t serial_port_index = 0;
 #endif
 
+#ifdef SERIAL_DROP_AUTO_REPORTS
+
+  uint16_t serial_dropped_reports; // = 0
+
+  #define _REPORT_FITS(S) (int(S.availableForWrite()) >= (SERIAL_DROP_AUTO_REPORTS))
+
+  /**
+   * Check that the port(s) selected by serial_port_index can take a report
+   * without waiting. If not, the caller should drop the report, so it's counted.
+   */
+  bool serial_report_fits() {
+    #if !HAS_MULTI_SERIAL
+      const bool fits = _REPORT_FITS(MYSERIAL0);
+    #elif defined(SERIAL_CATCHALL)
+      const bool fits = _REPORT_FITS(CAT(MYSERIAL,SERIAL_CATCHALL));
+    #else
+      const bool fits = ((serial_port_index && serial_port_index != SERIAL_BOTH) || _REPORT_FITS(MYSERIAL0))
+                     && (!serial_port_index || _REPORT_FITS(MYSERIAL1));
+    #endif
+    if (!fits) serial_dropped_reports++;
+    return fits;
+  }
+
+#endif
+
 void serialprintPGM(PGM_P str) {
   while (const char c = pgm_read_byte(str++)) SERIAL_CHAR(c);
 }
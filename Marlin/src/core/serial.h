@@ -69,6 +69,13 @@ extern uint8_t marlin_debug_flags;
   #define SERIAL_ASSERT(P)      NOOP
 #endif
 
+#ifdef SERIAL_DROP_AUTO_REPORTS
+  extern uint16_t serial_dropped_reports;
+  bool serial_report_fits();
+#else
+  inline bool serial_report_fits() { return true; }
+#endif
+
 #define PORT_REDIRECT(p)        _PORT_REDIRECT(1,p)
 #define PORT_RESTORE()          _PORT_RESTORE(1)
 
@@ -205,34 +205,36 @@ void print_bilinear_leveling_grid() {
     ) * 0.5f;
   }
 
-  static float bed_level_virt_2cmr(const uint8_t x, const uint8_t y, const float &tx, const float &ty) {
-    float row[4], column[4];
-    LOOP_L_N(i, 4) {
-      LOOP_L_N(j, 4) {
-        column[j] = bed_level_virt_coord(i + x - 1, j + y - 1);
-      }
-      row[i] = bed_level_virt_cmr(column, 1, ty);
-    }
-    return bed_level_virt_cmr(row, 1, tx);
-  }
-
+  /**
+   * Catmull-Rom is separable, so for each virtual row interpolate every column
+   * of the extended grid along Y once, then interpolate that row along X.
+   * This makes (GRID_MAX_POINTS_X + 2) column evaluations per virtual row
+   * instead of four for every virtual point. Grid rows and columns (t == 0)
+   * are copied as-is, which is what the spline gives there.
+   */
   void bed_level_virt_interpolate() {
     bilinear_grid_spacing_virt = bilinear_grid_spacing / (BILINEAR_SUBDIVISIONS);
     bilinear_grid_factor_virt = bilinear_grid_spacing_virt.reciprocal();
+    float row[ABL_TEMP_POINTS_X], column[4];
     LOOP_L_N(y, GRID_MAX_POINTS_Y)
-      LOOP_L_N(x, GRID_MAX_POINTS_X)
-        LOOP_L_N(ty, BILINEAR_SUBDIVISIONS)
+      LOOP_L_N(ty, BILINEAR_SUBDIVISIONS) {
+        if (ty && y == (GRID_MAX_POINTS_Y) - 1) break;
+        const float fy = (float)ty / (BILINEAR_SUBDIVISIONS);
+        LOOP_L_N(i, ABL_TEMP_POINTS_X) {
+          if (ty) {
+            LOOP_L_N(j, 4) column[j] = bed_level_virt_coord(i, j + y);
+            row[i] = bed_level_virt_cmr(column, 1, fy);
+          }
+          else
+            row[i] = bed_level_virt_coord(i, y + 1);
+        }
+        LOOP_L_N(x, GRID_MAX_POINTS_X)
           LOOP_L_N(tx, BILINEAR_SUBDIVISIONS) {
-            if ((ty && y == (GRID_MAX_POINTS_Y) - 1) || (tx && x == (GRID_MAX_POINTS_X) - 1))
-              continue;
+            if (tx && x == (GRID_MAX_POINTS_X) - 1) break;
             z_values_virt[x * (BILINEAR_SUBDIVISIONS) + tx][y * (BILINEAR_SUBDIVISIONS) + ty] =
-              bed_level_virt_2cmr(
-                x + 1,
-                y + 1,
-                (float)tx / (BILINEAR_SUBDIVISIONS),
-                (float)ty / (BILINEAR_SUBDIVISIONS)
-              );
+              tx ? bed_level_virt_cmr(row + x, 1, (float)tx / (BILINEAR_SUBDIVISIONS)) : row[x + 1];
           }
+      }
   }
 #endif // ABL_BILINEAR_SUBDIVISION
 
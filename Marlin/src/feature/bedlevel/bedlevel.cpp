@@ -73,6 +73,9 @@ void set_bed_leveling_enabled(const bool enable/*=true*/) {
       (void)bilinear_z_offset(reset);
     #endif
 
+    // Catch any mesh changes not yet in the cell cache
+    TERN_(UBL_CELL_CACHE, if (enable) ubl.refresh_cell_cache());
+
     if (planner.leveling_active) {      // leveling from on to off
       if (DEBUGGING(LEVELING)) DEBUG_POS("Leveling ON", current_position);
       // change unleveled current_position to physical current_position without moving steppers.
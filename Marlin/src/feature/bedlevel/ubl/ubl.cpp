@@ -86,6 +86,35 @@
 
   volatile int16_t unified_bed_leveling::encoder_diff;
 
+  #if ENABLED(UBL_CELL_CACHE)
+
+    unified_bed_leveling::mesh_cell_t unified_bed_leveling::cells[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+
+    void unified_bed_leveling::refresh_cell(const uint8_t cx, const uint8_t cy) {
+      const uint8_t x1 = _MIN(cx, GRID_MAX_POINTS_X - 2) + 1,
+                    y1 = _MIN(cy, GRID_MAX_POINTS_Y - 2) + 1;
+      const float z00 = z_values[cx][cy], z10 = z_values[x1][cy],
+                  z01 = z_values[cx][y1], z11 = z_values[x1][y1];
+      mesh_cell_t &c = cells[cx][cy];
+      c.z00 = z00;
+      c.dx = z10 - z00;
+      c.dy = z01 - z00;
+      c.dxy = z11 - z10 - z01 + z00;
+    }
+
+    void unified_bed_leveling::refresh_cell_cache() {
+      GRID_LOOP(x, y) refresh_cell(x, y);
+    }
+
+    void unified_bed_leveling::refresh_cell_cache(const uint8_t px, const uint8_t py) {
+      // The point is a corner of its own cell and of the cells left of and below it
+      for (uint8_t x = px ? px - 1 : 0; x <= px && x < GRID_MAX_POINTS_X; x++)
+        for (uint8_t y = py ? py - 1 : 0; y <= py && y < GRID_MAX_POINTS_Y; y++)
+          refresh_cell(x, y);
+    }
+
+  #endif // UBL_CELL_CACHE
+
   unified_bed_leveling::unified_bed_leveling() {
     reset();
   }
@@ -95,6 +124,7 @@
     set_bed_leveling_enabled(false);
     storage_slot = -1;
     ZERO(z_values);
+    TERN_(UBL_CELL_CACHE, refresh_cell_cache());
     #if ENABLED(EXTENSIBLE_UI)
       GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
     #endif
@@ -111,6 +141,7 @@
       z_values[x][y] = value;
       TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, value));
     }
+    TERN_(UBL_CELL_CACHE, refresh_cell_cache());
   }
 
   static void serial_echo_xy(const uint8_t sp, const int16_t x, const int16_t y) {
@@ -78,6 +78,10 @@ class unified_bed_leveling {
     }
     static void smart_fill_mesh();
 
+    #if ENABLED(UBL_CELL_CACHE)
+      static void refresh_cell(const uint8_t cx, const uint8_t cy);
+    #endif
+
     #if ENABLED(UBL_DEVEL_DEBUGGING)
       static void g29_what_command();
       static void g29_eeprom_dump();
@@ -109,6 +113,21 @@ class unified_bed_leveling {
     static const float _mesh_index_to_xpos[GRID_MAX_POINTS_X],
                        _mesh_index_to_ypos[GRID_MAX_POINTS_Y];
 
+    #if ENABLED(UBL_CELL_CACHE)
+      /**
+       * Bilinear coefficients for the cell whose lower left corner is
+       * z_values[cx][cy]. With u, v the position in the cell (0..1):
+       *   z = z00 + u * (dx + v * dxy) + v * dy
+       * Cells on the last row or column are flat in that direction, the
+       * same as the clamping done by get_z_correction without the cache.
+       * Call refresh_cell_cache() after changing z_values.
+       */
+      typedef struct { float z00, dx, dy, dxy; } mesh_cell_t;
+      static mesh_cell_t cells[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+      static void refresh_cell_cache();
+      static void refresh_cell_cache(const uint8_t px, const uint8_t py); // Cells that use one mesh point
+    #endif
+
     #if HAS_LCD_MENU
       static bool lcd_map_control;
       static void steppers_were_disabled();
@@ -120,7 +139,7 @@ class unified_bed_leveling {
 
     unified_bed_leveling();
 
-    FORCE_INLINE static void set_z(const int8_t px, const int8_t py, const float &z) { z_values[px][py] = z; }
+    FORCE_INLINE static void set_z(const int8_t px, const int8_t py, const float &z) { z_values[px][py] = z; TERN_(UBL_CELL_CACHE, refresh_cell_cache(px, py)); }
 
     static int8_t cell_index_x(const float &x) {
       const int8_t cx = (x - (MESH_MIN_X)) * RECIPROCAL(MESH_X_DIST);
@@ -236,11 +255,10 @@ class unified_bed_leveling {
      * This is the generic Z-Correction. It works anywhere within a Mesh Cell. It first
      * does a linear interpolation along both of the bounding X-Mesh-Lines to find the
      * Z-Height at both ends. Then it does a linear interpolation of these heights based
-     * on the Y position within the cell.
+     * on the Y position within the cell. With UBL_CELL_CACHE the same result comes from
+     * the cell's precomputed coefficients.
      */
     static float get_z_correction(const float &rx0, const float &ry0) {
-      const int8_t cx = cell_index_x(rx0), cy = cell_index_y(ry0); // return values are clamped
-
       /**
        * Check if the requested location is off the mesh.  If so, and
        * UBL_Z_RAISE_WHEN_OFF_MESH is specified, that value is returned.
@@ -250,17 +268,34 @@ class unified_bed_leveling {
           return UBL_Z_RAISE_WHEN_OFF_MESH;
       #endif
 
-      const float z1 = calc_z0(rx0,
-                               mesh_index_to_xpos(cx), z_values[cx][cy],
-                               mesh_index_to_xpos(cx + 1), z_values[_MIN(cx, GRID_MAX_POINTS_X - 2) + 1][cy]);
+      #if ENABLED(UBL_CELL_CACHE)
+
+        const float fx = (rx0 - (MESH_MIN_X)) * RECIPROCAL(MESH_X_DIST),
+                    fy = (ry0 - (MESH_MIN_Y)) * RECIPROCAL(MESH_Y_DIST);
+        const int8_t cx = constrain(int8_t(fx), 0, (GRID_MAX_POINTS_X) - 1),
+                     cy = constrain(int8_t(fy), 0, (GRID_MAX_POINTS_Y) - 1);
+        const mesh_cell_t &c = cells[cx][cy];
+        const float u = fx - cx, v = fy - cy;   // May be outside 0..1 off the mesh, as below
+
+        float z0 = c.z00 + u * (c.dx + v * c.dxy) + v * c.dy;
+
+      #else
+
+        const int8_t cx = cell_index_x(rx0), cy = cell_index_y(ry0); // return values are clamped
+
+        const float z1 = calc_z0(rx0,
+                                 mesh_index_to_xpos(cx), z_values[cx][cy],
+                                 mesh_index_to_xpos(cx + 1), z_values[_MIN(cx, GRID_MAX_POINTS_X - 2) + 1][cy]);
+
+        const float z2 = calc_z0(rx0,
+                                 mesh_index_to_xpos(cx), z_values[cx][_MIN(cy, GRID_MAX_POINTS_Y - 2) + 1],
+                                 mesh_index_to_xpos(cx + 1), z_values[_MIN(cx, GRID_MAX_POINTS_X - 2) + 1][_MIN(cy, GRID_MAX_POINTS_Y - 2) + 1]);
 
-      const float z2 = calc_z0(rx0,
-                               mesh_index_to_xpos(cx), z_values[cx][_MIN(cy, GRID_MAX_POINTS_Y - 2) + 1],
-                               mesh_index_to_xpos(cx + 1), z_values[_MIN(cx, GRID_MAX_POINTS_X - 2) + 1][_MIN(cy, GRID_MAX_POINTS_Y - 2) + 1]);
+        float z0 = calc_z0(ry0,
+                           mesh_index_to_ypos(cy), z1,
+                           mesh_index_to_ypos(cy + 1), z2);
 
-      float z0 = calc_z0(ry0,
-                         mesh_index_to_ypos(cy), z1,
-                         mesh_index_to_ypos(cy + 1), z2);
+      #endif // !UBL_CELL_CACHE
 
       if (DEBUGGING(MESH_ADJUST)) {
         DEBUG_ECHOPAIR(" raw get_z_correction(", rx0);
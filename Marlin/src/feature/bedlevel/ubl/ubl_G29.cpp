@@ -550,6 +550,7 @@
                   // P3.1  use least squares fit to fill missing mesh values
                   // P3.10 zero weighting for distance, all grid points equal, best fit tilted plane
                   // P3.11 10X weighting for nearest grid points versus farthest grid points
+                  //       (the extra weight halves with each grid step away)
                   // P3.12 100X distance weighting
                   // P3.13 1000X distance weighting, approaches simple average of nearest points
 
@@ -737,6 +738,7 @@
 
       mesh_index_pair best;
       TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::MESH_START));
+      TERN_(PROBE_FAST_SCAN, probe.scan_start());
       do {
         if (do_ubl_mesh_map) display_map(g29_map_type);
 
@@ -751,6 +753,7 @@
             ui.wait_for_release();
             ui.quick_feedback();
             ui.release();
+            TERN_(PROBE_FAST_SCAN, probe.scan_end());
             probe.stow(); // Release UI before stow to allow for PAUSE_BEFORE_DEPLOY_STOW
             return restore_ubl_active_state_and_leave();
           }
@@ -776,6 +779,7 @@
 
       } while (best.pos.x >= 0 && --count);
 
+      TERN_(PROBE_FAST_SCAN, probe.scan_end());
       TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::MESH_FINISH));
 
       // Release UI during stow to allow for PAUSE_BEFORE_DEPLOY_STOW
@@ -1025,6 +1029,7 @@
         if (click_and_hold(abort_fine_tune)) break;         // Button held down? Abort editing
 
         z_values[lpos.x][lpos.y] = new_z;                   // Save the updated Z value
+        TERN_(UBL_CELL_CACHE, refresh_cell_cache(lpos.x, lpos.y));
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location, new_z));
 
         serial_delay(20);                                   // No switch noise
@@ -1364,62 +1369,22 @@
       incremental_LSF_reset(&lsf_results);
 
       if (do_3_pt_leveling) {
-        SERIAL_ECHOLNPGM("Tilting mesh (1/3)");
-        TERN_(HAS_DISPLAY, ui.status_printf_P(0, PSTR(S_FMT " 1/3"), GET_TEXT(MSG_LCD_TILTING_MESH)));
-
-        measured_z = probe.probe_at_point(points[0], PROBE_PT_RAISE, g29_verbose_level);
-        if (isnan(measured_z))
-          abort_flag = true;
-        else {
-          measured_z -= get_z_correction(points[0]);
-          #ifdef VALIDATE_MESH_TILT
-            z1 = measured_z;
-          #endif
+        SERIAL_ECHOLNPGM("Tilting mesh (3 points)");
+
+        // Probe in travel order. The probe is stowed below.
+        float z[3];
+        abort_flag = isnan(probe.probe_points(points, z, 3, PROBE_PT_RAISE, g29_verbose_level, true, true, 0, TERN(HAS_DISPLAY, GET_TEXT(MSG_LCD_TILTING_MESH), nullptr)));
+
+        if (!abort_flag) LOOP_L_N(i, 3) {
+          measured_z = z[i] - get_z_correction(points[i]);
           if (g29_verbose_level > 3) {
             serial_spaces(16);
             SERIAL_ECHOLNPAIR("Corrected_Z=", measured_z);
           }
-          incremental_LSF(&lsf_results, points[0], measured_z);
-        }
-
-        if (!abort_flag) {
-          SERIAL_ECHOLNPGM("Tilting mesh (2/3)");
-          TERN_(HAS_DISPLAY, ui.status_printf_P(0, PSTR(S_FMT " 2/3"), GET_TEXT(MSG_LCD_TILTING_MESH)));
-
-          measured_z = probe.probe_at_point(points[1], PROBE_PT_RAISE, g29_verbose_level);
-          #ifdef VALIDATE_MESH_TILT
-            z2 = measured_z;
-          #endif
-          if (isnan(measured_z))
-            abort_flag = true;
-          else {
-            measured_z -= get_z_correction(points[1]);
-            if (g29_verbose_level > 3) {
-              serial_spaces(16);
-              SERIAL_ECHOLNPAIR("Corrected_Z=", measured_z);
-            }
-            incremental_LSF(&lsf_results, points[1], measured_z);
-          }
-        }
-
-        if (!abort_flag) {
-          SERIAL_ECHOLNPGM("Tilting mesh (3/3)");
-          TERN_(HAS_DISPLAY, ui.status_printf_P(0, PSTR(S_FMT " 3/3"), GET_TEXT(MSG_LCD_TILTING_MESH)));
-
-          measured_z = probe.probe_at_point(points[2], PROBE_PT_STOW, g29_verbose_level);
+          incremental_LSF(&lsf_results, points[i], measured_z);
           #ifdef VALIDATE_MESH_TILT
-            z3 = measured_z;
+            (i == 0 ? z1 : i == 1 ? z2 : z3) = measured_z;
           #endif
-          if (isnan(measured_z))
-            abort_flag = true;
-          else {
-            measured_z -= get_z_correction(points[2]);
-            if (g29_verbose_level > 3) {
-              serial_spaces(16);
-              SERIAL_ECHOLNPAIR("Corrected_Z=", measured_z);
-            }
-            incremental_LSF(&lsf_results, points[2], measured_z);
-          }
         }
 
         probe.stow();
@@ -1591,47 +1556,64 @@
       // from all the originally populated mesh points, weighted toward the point
       // being extrapolated so that nearby points will have greater influence on
       // the point being extrapolated.  Then extrapolate the mesh point from WLSF.
+      //
+      // A point n grid steps away (|dx| + |dy|) gets a weight of 1 + weight_factor * 2^(1-n).
+      // Since the falloff is separable the weighted sums for a whole row come from
+      // running sums along X, so the time grows as N * GRID_MAX_POINTS_Y and not N^2.
+      // Mesh indexes serve as coordinates, which gives the same plane as positions.
 
       static_assert((GRID_MAX_POINTS_Y) <= 16, "GRID_MAX_POINTS_Y too big");
       uint16_t bitmap[GRID_MAX_POINTS_X] = { 0 };
-      struct linear_fit_data lsf_results;
+      struct linear_fit_data lsf_all, lsf_run, lsf_results[GRID_MAX_POINTS_X];
 
       SERIAL_ECHOPGM("Extrapolating mesh...");
 
-      const float weight_scaled = weight_factor * _MAX(MESH_X_DIST, MESH_Y_DIST);
-
-      GRID_LOOP(jx, jy) if (!isnan(z_values[jx][jy])) SBI(bitmap[jx], jy);
-
-      xy_pos_t ppos;
-      LOOP_L_N(ix, GRID_MAX_POINTS_X) {
-        ppos.x = mesh_index_to_xpos(ix);
-        LOOP_L_N(iy, GRID_MAX_POINTS_Y) {
-          ppos.y = mesh_index_to_ypos(iy);
-          if (isnan(z_values[ix][iy])) {
-            // undefined mesh point at (ppos.x,ppos.y), compute weighted LSF from original valid mesh points.
-            incremental_LSF_reset(&lsf_results);
-            xy_pos_t rpos;
-            LOOP_L_N(jx, GRID_MAX_POINTS_X) {
-              rpos.x = mesh_index_to_xpos(jx);
-              LOOP_L_N(jy, GRID_MAX_POINTS_Y) {
-                if (TEST(bitmap[jx], jy)) {
-                  rpos.y = mesh_index_to_ypos(jy);
-                  const float rz = z_values[jx][jy],
-                               w = 1.0f + weight_scaled / (rpos - ppos).magnitude();
-                  incremental_WLSF(&lsf_results, rpos, rz, w);
-                }
-              }
-            }
-            if (finish_incremental_LSF(&lsf_results)) {
-              SERIAL_ECHOLNPGM("Insufficient data");
-              return;
-            }
-            const float ez = -lsf_results.D - lsf_results.A * ppos.x - lsf_results.B * ppos.y;
-            z_values[ix][iy] = ez;
-            TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ix, iy, z_values[ix][iy]));
-            idle(); // housekeeping
+      // The unweighted part of the fit is the same for every point
+      incremental_LSF_reset(&lsf_all);
+      GRID_LOOP(jx, jy) if (!isnan(z_values[jx][jy])) {
+        SBI(bitmap[jx], jy);
+        incremental_LSF(&lsf_all, jx, jy, z_values[jx][jy]);
+      }
+
+      LOOP_L_N(iy, GRID_MAX_POINTS_Y) {
+        bool row_complete = true;
+        LOOP_L_N(ix, GRID_MAX_POINTS_X) if (!TEST(bitmap[ix], iy)) { row_complete = false; break; }
+        if (row_complete) continue;
+
+        LOOP_L_N(ix, GRID_MAX_POINTS_X) incremental_LSF_reset(&lsf_results[ix]);
+
+        // Add every original mesh row into the nearby weighting of row iy, halving
+        // the weight per step in Y and (with running sums in both directions) in X.
+        if (weight_factor) LOOP_L_N(jy, GRID_MAX_POINTS_Y) {
+          const float wy = 2.0f * weight_factor / float(1UL << ABS(int8_t(jy) - int8_t(iy)));
+          incremental_LSF_reset(&lsf_run);
+          LOOP_L_N(jx, GRID_MAX_POINTS_X) {                           // Points at or left of jx
+            incremental_LSF_scale(&lsf_run, 0.5f);
+            if (TEST(bitmap[jx], jy)) incremental_LSF(&lsf_run, jx, jy, z_values[jx][jy]);
+            incremental_LSF_merge(&lsf_results[jx], &lsf_run, wy);
+          }
+          incremental_LSF_reset(&lsf_run);
+          for (uint8_t jx = GRID_MAX_POINTS_X - 1; jx > 0; jx--) {   // Points right of jx - 1
+            if (TEST(bitmap[jx], jy)) incremental_LSF(&lsf_run, jx, jy, z_values[jx][jy]);
+            incremental_LSF_scale(&lsf_run, 0.5f);
+            incremental_LSF_merge(&lsf_results[jx - 1], &lsf_run, wy);
+          }
+        }
+
+        LOOP_L_N(ix, GRID_MAX_POINTS_X) {
+          if (TEST(bitmap[ix], iy)) continue;
+          // undefined mesh point at (ix,iy), add the unweighted fit of all original valid mesh points.
+          linear_fit_data &lsf = lsf_results[ix];
+          incremental_LSF_merge(&lsf, &lsf_all, 1.0f);
+          if (finish_incremental_LSF(&lsf)) {
+            SERIAL_ECHOLNPGM("Insufficient data");
+            return;
           }
+          const float ez = -lsf.D - lsf.A * ix - lsf.B * iy;
+          z_values[ix][iy] = ez;
+          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ix, iy, z_values[ix][iy]));
         }
+        idle(); // housekeeping
       }
 
       SERIAL_ECHOLNPGM("done");
@@ -76,19 +76,32 @@
       // The distance is always MESH_X_DIST so multiply by the constant reciprocal.
       const float xratio = (end.x - mesh_index_to_xpos(iend.x)) * RECIPROCAL(MESH_X_DIST);
 
-      float z1, z2;
-      if (iend.x >= GRID_MAX_POINTS_X - 1)
-        z1 = z2 = 0.0;
-      else {
-        z1 = z_values[iend.x    ][iend.y    ] + xratio *
-            (z_values[iend.x + 1][iend.y    ] - z_values[iend.x][iend.y    ]),
-        z2 = z_values[iend.x    ][iend.y + 1] + xratio *
-            (z_values[iend.x + 1][iend.y + 1] - z_values[iend.x][iend.y + 1]);
-      }
+      #if ENABLED(UBL_CELL_CACHE)
+
+        const float yratio = (end.y - mesh_index_to_ypos(iend.y)) * RECIPROCAL(MESH_Y_DIST);
+        float z0 = 0.0;
+        if (iend.x < GRID_MAX_POINTS_X - 1 && iend.y < GRID_MAX_POINTS_Y - 1) {
+          const mesh_cell_t &c = cells[iend.x][iend.y];
+          z0 = (c.z00 + xratio * (c.dx + yratio * c.dxy) + yratio * c.dy) * planner.fade_scaling_factor_for_z(end.z);
+        }
+
+      #else
+
+        float z1, z2;
+        if (iend.x >= GRID_MAX_POINTS_X - 1)
+          z1 = z2 = 0.0;
+        else {
+          z1 = z_values[iend.x    ][iend.y    ] + xratio *
+              (z_values[iend.x + 1][iend.y    ] - z_values[iend.x][iend.y    ]),
+          z2 = z_values[iend.x    ][iend.y + 1] + xratio *
+              (z_values[iend.x + 1][iend.y + 1] - z_values[iend.x][iend.y + 1]);
+        }
 
-      // X cell-fraction done. Interpolate the two Z offsets with the Y fraction for the final Z offset.
-      const float yratio = (end.y - mesh_index_to_ypos(iend.y)) * RECIPROCAL(MESH_Y_DIST),
-                  z0 = iend.y < GRID_MAX_POINTS_Y - 1 ? (z1 + (z2 - z1) * yratio) * planner.fade_scaling_factor_for_z(end.z) : 0.0;
+        // X cell-fraction done. Interpolate the two Z offsets with the Y fraction for the final Z offset.
+        const float yratio = (end.y - mesh_index_to_ypos(iend.y)) * RECIPROCAL(MESH_Y_DIST),
+                    z0 = iend.y < GRID_MAX_POINTS_Y - 1 ? (z1 + (z2 - z1) * yratio) * planner.fade_scaling_factor_for_z(end.z) : 0.0;
+
+      #endif
 
       // Undefined parts of the Mesh in z_values[][] are NAN.
       // Replace NAN corrections with 0.0 to prevent NAN propagation.
@@ -364,21 +377,38 @@
 
     xyze_pos_t raw = current_position;
 
+    #if ENABLED(DELTA)
+      // Segments go to the planner in batches for the batched inverse kinematics
+      xyze_pos_t batch[DELTA_IK_BATCH];
+      uint8_t batched = 0;
+    #endif
+
     // Just do plain segmentation if UBL is inactive or the target is above the fade height
     if (!planner.leveling_active || !planner.leveling_active_at_z(destination.z)) {
-      while (--segments) {
-        raw += diff;
-        planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, segment_xyz_mm
+      #if ENABLED(DELTA)
+        while (segments) {
+          do {
+            raw += diff;
+            batch[batched++] = --segments ? raw : destination;
+          } while (segments && batched < DELTA_IK_BATCH);
+          planner.buffer_lines(batch, batched, scaled_fr_mm_s, active_extruder, segment_xyz_mm);
+          batched = 0;
+        }
+      #else
+        while (--segments) {
+          raw += diff;
+          planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, segment_xyz_mm
+            #if ENABLED(SCARA_FEEDRATE_SCALING)
+              , inv_duration
+            #endif
+          );
+        }
+        planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, segment_xyz_mm
           #if ENABLED(SCARA_FEEDRATE_SCALING)
             , inv_duration
           #endif
         );
-      }
-      planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, segment_xyz_mm
-        #if ENABLED(SCARA_FEEDRATE_SCALING)
-          , inv_duration
-        #endif
-      );
+      #endif
       return false; // Did not set current from destination
     }
 
@@ -407,22 +437,46 @@
       LIMIT(icell.x, 0, (GRID_MAX_POINTS_X) - 1);
       LIMIT(icell.y, 0, (GRID_MAX_POINTS_Y) - 1);
 
-      float z_x0y0 = z_values[icell.x  ][icell.y  ],  // z at lower left corner
-            z_x1y0 = z_values[icell.x+1][icell.y  ],  // z at upper left corner
-            z_x0y1 = z_values[icell.x  ][icell.y+1],  // z at lower right corner
-            z_x1y1 = z_values[icell.x+1][icell.y+1];  // z at upper right corner
+      #if ENABLED(UBL_CELL_CACHE)
+
+        mesh_cell_t c = cells[icell.x][icell.y];
+        if (isnan(c.z00 + c.dx + c.dy + c.dxy)) {   // Undefined corner(s) are guessed as zero one by one,
+          const uint8_t x1 = _MIN(icell.x, GRID_MAX_POINTS_X - 2) + 1,  //   the same as the uncached path
+                        y1 = _MIN(icell.y, GRID_MAX_POINTS_Y - 2) + 1;
+          float z00 = z_values[icell.x][icell.y], z10 = z_values[x1][icell.y],
+                z01 = z_values[icell.x][y1],      z11 = z_values[x1][y1];
+          if (isnan(z00)) z00 = 0;
+          if (isnan(z10)) z10 = 0;
+          if (isnan(z01)) z01 = 0;
+          if (isnan(z11)) z11 = 0;
+          c = { z00, z10 - z00, z01 - z00, z11 - z10 - z01 + z00 };
+        }
+
+        const float z_x0y0 = c.z00,                                         // z at lower left corner
+                    z_x0y1 = c.z00 + c.dy,                                  // z at lower right corner
+                    z_xmy0 = c.dx * RECIPROCAL(MESH_X_DIST),                // z slope per x along y0 (lower left to lower right)
+                    z_xmy1 = (c.dx + c.dxy) * RECIPROCAL(MESH_X_DIST);      // z slope per x along y1 (upper left to upper right)
+
+      #else
+
+        float z_x0y0 = z_values[icell.x  ][icell.y  ],  // z at lower left corner
+              z_x1y0 = z_values[icell.x+1][icell.y  ],  // z at upper left corner
+              z_x0y1 = z_values[icell.x  ][icell.y+1],  // z at lower right corner
+              z_x1y1 = z_values[icell.x+1][icell.y+1];  // z at upper right corner
+
+        if (isnan(z_x0y0)) z_x0y0 = 0;              // ideally activating planner.leveling_active (G29 A)
+        if (isnan(z_x1y0)) z_x1y0 = 0;              //   should refuse if any invalid mesh points
+        if (isnan(z_x0y1)) z_x0y1 = 0;              //   in order to avoid isnan tests per cell,
+        if (isnan(z_x1y1)) z_x1y1 = 0;              //   thus guessing zero for undefined points
+
+        const float z_xmy0 = (z_x1y0 - z_x0y0) * RECIPROCAL(MESH_X_DIST),   // z slope per x along y0 (lower left to lower right)
+                    z_xmy1 = (z_x1y1 - z_x0y1) * RECIPROCAL(MESH_X_DIST);   // z slope per x along y1 (upper left to upper right)
 
-      if (isnan(z_x0y0)) z_x0y0 = 0;              // ideally activating planner.leveling_active (G29 A)
-      if (isnan(z_x1y0)) z_x1y0 = 0;              //   should refuse if any invalid mesh points
-      if (isnan(z_x0y1)) z_x0y1 = 0;              //   in order to avoid isnan tests per cell,
-      if (isnan(z_x1y1)) z_x1y1 = 0;              //   thus guessing zero for undefined points
+      #endif
 
       const xy_pos_t pos = { mesh_index_to_xpos(icell.x), mesh_index_to_ypos(icell.y) };
       xy_pos_t cell = raw - pos;
 
-      const float z_xmy0 = (z_x1y0 - z_x0y0) * RECIPROCAL(MESH_X_DIST),   // z slope per x along y0 (lower left to lower right)
-                  z_xmy1 = (z_x1y1 - z_x0y1) * RECIPROCAL(MESH_X_DIST);   // z slope per x along y1 (upper left to upper right)
-
             float z_cxy0 = z_x0y0 + z_xmy0 * cell.x;        // z height along y0 at cell.x (changes for each cell.x in cell)
 
       const float z_cxy1 = z_x0y1 + z_xmy1 * cell.x,        // z height along y1 at cell.x
@@ -449,11 +503,20 @@
           #endif
         ;
 
-        planner.buffer_line(raw.x, raw.y, raw.z + z_cxcy, raw.e, scaled_fr_mm_s, active_extruder, segment_xyz_mm
-          #if ENABLED(SCARA_FEEDRATE_SCALING)
-            , inv_duration
-          #endif
-        );
+        #if ENABLED(DELTA)
+          batch[batched] = raw;
+          batch[batched].z += z_cxcy;
+          if (++batched == DELTA_IK_BATCH || segments == 0) {
+            planner.buffer_lines(batch, batched, scaled_fr_mm_s, active_extruder, segment_xyz_mm);
+            batched = 0;
+          }
+        #else
+          planner.buffer_line(raw.x, raw.y, raw.z + z_cxcy, raw.e, scaled_fr_mm_s, active_extruder, segment_xyz_mm
+            #if ENABLED(SCARA_FEEDRATE_SCALING)
+              , inv_duration
+            #endif
+          );
+        #endif
 
         if (segments == 0)                        // done with last segment
           return false;                           // didn't set current from destination
@@ -0,0 +1,170 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Motion Benchmark
+ *
+ * Measure the planner and stepper hot paths on the host clock. Meant for the
+ * linux_native build, where a G-code corpus can be replayed on the virtual
+ * clock with buildroot/share/scripts/linux_benchmark.sh.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MOTION_BENCHMARK)
+
+#include "benchmark.h"
+#include "../gcode/parser.h"
+
+MotionBenchmark motion_benchmark;
+
+MotionBenchmark::stage_stats_t MotionBenchmark::stats[STAGE_COUNT];
+uint32_t MotionBenchmark::segments, MotionBenchmark::blocks_planned, MotionBenchmark::blocks_executed;
+uint32_t MotionBenchmark::recalc_calls, MotionBenchmark::recalc_blocks[RECALC_PASSES];
+uint8_t MotionBenchmark::recalc_max[RECALC_PASSES], MotionBenchmark::recalc_call[RECALC_PASSES];
+char MotionBenchmark::float_sample[BENCHMARK_FLOATS][12];
+uint16_t MotionBenchmark::float_count, MotionBenchmark::float_index;
+bool MotionBenchmark::float_timing;
+uint64_t MotionBenchmark::start_ns;
+millis_t MotionBenchmark::start_ms;
+
+void MotionBenchmark::add(const Stage s, const uint32_t ns) {
+  stage_stats_t &st = stats[s];
+  st.count++;
+  st.total_ns += ns;
+  NOLESS(st.max_ns, ns);
+  uint8_t b = 0;
+  for (uint32_t v = ns; v > 1 && b < BENCHMARK_BUCKETS - 1; v >>= 1) b++;
+  st.histogram[b]++;
+}
+
+void MotionBenchmark::recalc_done() {
+  recalc_calls++;
+  LOOP_L_N(p, RECALC_PASSES) {
+    recalc_blocks[p] += recalc_call[p];
+    NOLESS(recalc_max[p], recalc_call[p]);
+    recalc_call[p] = 0;
+  }
+}
+
+// Keep a copy of a number word from the G-code
+void MotionBenchmark::sample_float(const char *p) {
+  if (float_timing) return;
+  char * const d = float_sample[float_index];
+  if (++float_index >= BENCHMARK_FLOATS) float_index = 0;
+  uint8_t i = 0;
+  for (; i < sizeof(float_sample[0]) - 1 && (DECIMAL_SIGNED(p[i]) || p[i] == 'x' || p[i] == 'X'); i++) d[i] = p[i];
+  d[i] = '\0';
+  if (float_count < BENCHMARK_FLOATS) float_count++;
+}
+
+/**
+ * Time GCodeParser::parse_float against strtof on the sampled number words
+ * and count the words where the two results differ
+ */
+void MotionBenchmark::report_floats() {
+  constexpr uint16_t reps = 1000;
+  const uint16_t n = float_count;
+  volatile float sink;
+  float_timing = true;
+
+  uint64_t t = now_ns();
+  for (uint16_t r = 0; r < reps; r++)
+    for (uint16_t i = 0; i < n; i++) sink = GCodeParser::parse_float(float_sample[i]);
+  const float fast_ns = float(now_ns() - t) / (reps * n);
+
+  t = now_ns();
+  for (uint16_t r = 0; r < reps; r++)
+    for (uint16_t i = 0; i < n; i++) sink = GCodeParser::strtof_no_exp(float_sample[i]);
+  const float strtof_ns = float(now_ns() - t) / (reps * n);
+  UNUSED(sink);
+
+  uint16_t differ = 0;
+  for (uint16_t i = 0; i < n; i++)
+    if (GCodeParser::parse_float(float_sample[i]) != GCodeParser::strtof_no_exp(float_sample[i])) differ++;
+
+  float_timing = false;
+  SERIAL_ECHOLNPAIR(" Float parse: n=", n, " parse_float=", fast_ns, "ns strtof=", strtof_ns, "ns differ=", differ);
+}
+
+void MotionBenchmark::reset() {
+  ZERO(stats);
+  segments = blocks_planned = blocks_executed = 0;
+  recalc_calls = 0;
+  ZERO(recalc_blocks);
+  ZERO(recalc_max);
+  float_count = float_index = 0;
+  start_ns = now_ns();
+  start_ms = millis();
+}
+
+static void print_rate(PGM_P const label, const uint32_t n, const float secs) {
+  serialprintPGM(label);
+  SERIAL_ECHO(n);
+  if (secs > 0) SERIAL_ECHOPAIR(" (", n / secs, "/s)");
+  SERIAL_EOL();
+}
+
+void MotionBenchmark::report() {
+  const float sim_secs = (millis() - start_ms) * 0.001f,
+              host_secs = (now_ns() - start_ns) * 1e-9f;
+
+  SERIAL_ECHOLNPAIR("Motion benchmark - machine time: ", sim_secs, "s  host time: ", host_secs, "s");
+  print_rate(PSTR(" Segments: "), segments, sim_secs);
+  print_rate(PSTR(" Blocks planned: "), blocks_planned, sim_secs);
+  print_rate(PSTR(" Blocks executed: "), blocks_executed, sim_secs);
+
+  if (recalc_calls) {
+    static const char * const pass_name[RECALC_PASSES] = { "reverse", "forward", "trapezoid" };
+    SERIAL_ECHOLNPAIR(" Recalculate calls: ", recalc_calls);
+    LOOP_L_N(p, RECALC_PASSES) {
+      SERIAL_ECHO("  ");
+      SERIAL_ECHO(pass_name[p]);
+      SERIAL_ECHOLNPAIR(" blocks/call: ", float(recalc_blocks[p]) / recalc_calls, " max=", recalc_max[p]);
+    }
+  }
+
+  static const char * const stage_name[STAGE_COUNT] = { "parse", "plan", "recalculate", "stepper isr", "pulse phase", "block phase" };
+
+  LOOP_L_N(s, STAGE_COUNT) {
+    const stage_stats_t &st = stats[s];
+    if (!st.count) continue;
+    const float mean_ns = float(st.total_ns) / st.count;
+    SERIAL_CHAR(' ');
+    SERIAL_ECHO(stage_name[s]);
+    SERIAL_ECHOPAIR(": n=", st.count, " mean=", mean_ns, "ns max=", st.max_ns, "ns");
+    if (mean_ns > 0) SERIAL_ECHOPAIR(" sustained=", 1e9f / mean_ns, "/s");
+    SERIAL_EOL();
+    LOOP_L_N(b, BENCHMARK_BUCKETS - 1)
+      if (st.histogram[b]) SERIAL_ECHOLNPAIR("  <", uint32_t(2) << b, "ns: ", st.histogram[b]);
+    // The top bucket also holds everything longer
+    if (st.histogram[BENCHMARK_BUCKETS - 1])
+      SERIAL_ECHOLNPAIR("  >=", uint32_t(1) << (BENCHMARK_BUCKETS - 1), "ns: ", st.histogram[BENCHMARK_BUCKETS - 1]);
+  }
+
+  if (float_count) report_floats();
+
+  SERIAL_ECHOLNPAIR(" Worst stepper ISR: ", stats[STAGE_STEPPER_ISR].max_ns, "ns");
+  SERIAL_ECHOLNPGM("Benchmark end");
+}
+
+#endif // MOTION_BENCHMARK
@@ -0,0 +1,111 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Motion Benchmark
+ *
+ * Host-timed histograms of the planner and stepper hot paths,
+ * plus block and segment throughput counters, the number of
+ * blocks each Planner::recalculate pass visits, and a float
+ * parser comparison on the numbers seen in the G-code. See M990.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "../core/millis_t.h"
+
+#include <chrono>
+
+#define BENCHMARK_BUCKETS 32  // Powers of 2 in nanoseconds, up to ~4s
+#define BENCHMARK_FLOATS   256  // Number words kept to compare parse_float with strtof
+
+class MotionBenchmark {
+public:
+  enum Stage : uint8_t {
+    STAGE_PARSE,        // GCodeParser::parse
+    STAGE_PLAN,         // Planner::_buffer_steps, without waiting for a free block
+    STAGE_RECALCULATE,  // Planner::recalculate, part of STAGE_PLAN
+    STAGE_STEPPER_ISR,  // Stepper::isr, all phases
+    STAGE_PULSE_PHASE,  // Stepper::pulse_phase_isr
+    STAGE_BLOCK_PHASE,  // Stepper::block_phase_isr
+    STAGE_COUNT
+  };
+
+  typedef struct {
+    uint32_t count, max_ns;
+    uint64_t total_ns;
+    uint32_t histogram[BENCHMARK_BUCKETS];
+  } stage_stats_t;
+
+  enum RecalcPass : uint8_t {
+    RECALC_REVERSE,     // Blocks given to reverse_pass_kernel
+    RECALC_FORWARD,     // Blocks visited by the forward pass
+    RECALC_TRAPEZOID,   // Blocks visited by recalculate_trapezoids
+    RECALC_PASSES
+  };
+
+  static stage_stats_t stats[STAGE_COUNT];
+  static uint32_t segments,           // Segments handed to the planner
+                  blocks_planned,     // Blocks added to the block buffer
+                  blocks_executed;    // Blocks taken by the stepper ISR
+
+  static uint32_t recalc_calls,                   // Calls to Planner::recalculate
+                  recalc_blocks[RECALC_PASSES];   // Blocks visited by each pass, in total
+  static uint8_t recalc_max[RECALC_PASSES];       // Most blocks visited by each pass in one call
+
+  FORCE_INLINE static void recalc_count(const RecalcPass p) { recalc_call[p]++; }
+  static void recalc_done();
+
+  static void sample_float(const char *p);
+
+  static inline uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  static void add(const Stage s, const uint32_t ns);
+  static void reset();
+  static void report();
+
+  // Time the enclosing scope
+  class Scope {
+  public:
+    Scope(const Stage s) : stage(s), start(now_ns()) {}
+    ~Scope() { add(stage, uint32_t(now_ns() - start)); }
+  private:
+    const Stage stage;
+    const uint64_t start;
+  };
+
+private:
+  static uint8_t recalc_call[RECALC_PASSES];  // Blocks visited in the current call
+  static char float_sample[BENCHMARK_FLOATS][12]; // Recent number words, as text
+  static uint16_t float_count,                // Number words seen, up to BENCHMARK_FLOATS
+                  float_index;                // Next float_sample to replace
+  static bool float_timing;                   // Don't sample the words being timed
+  static void report_floats();
+  static uint64_t start_ns;   // Host time at reset
+  static millis_t start_ms;   // Machine time at reset
+};
+
+extern MotionBenchmark motion_benchmark;
+
+#define BENCHMARK_SCOPE(S) MotionBenchmark::Scope _benchmark_scope(MotionBenchmark::STAGE_##S)
@@ -0,0 +1,100 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(BINARY_GCODE)
+
+#include "binary_gcode.h"
+#include "../libs/crc16.h"
+
+BinaryGcode::Result BinaryGcode::receive(char * const buf, int &count, const uint8_t c) {
+  buf[count++] = c;
+  if (count < BG_HEADER_LEN) return BG_PENDING;
+  if (count == BG_HEADER_LEN && !WITHIN(c, BG_PARAMS_LEN, BG_MAX_LEN)) return BG_BAD_LENGTH;
+  return count < frame_size(buf) ? BG_PENDING : validate(buf);
+}
+
+BinaryGcode::Result BinaryGcode::validate(const char * const buf) {
+  const uint8_t len = buf[1];
+  if (!WITHIN(len, BG_PARAMS_LEN, BG_MAX_LEN)) return BG_BAD_LENGTH;
+
+  uint16_t crc = 0;
+  crc16(&crc, &buf[1], 1 + len);
+  if (crc != get_u16(&buf[BG_HEADER_LEN + len])) return BG_BAD_CRC;
+
+  const uint8_t f = flags(buf);
+  const uint32_t p = params(buf);
+  if ((f & ~(BG_FLAG_LINE | BG_FLAG_SUB | BG_FLAG_BARE)) || (p >> 26) || (uint8_t(buf[3]) >> 6) > 2)
+    return BG_BAD_FIELDS;
+
+  // The optional fields and values must fill the frame exactly
+  uint8_t need = BG_PARAMS_LEN;
+  if (f & BG_FLAG_LINE) need += 4;
+  if (f & BG_FLAG_SUB) need++;
+  uint32_t bare = 0;
+  if (f & BG_FLAG_BARE) {
+    if (need + 4 > len) return BG_BAD_LENGTH;
+    bare = get_u32(&buf[BG_HEADER_LEN + need]);
+    if (bare & ~p) return BG_BAD_FIELDS;
+    need += 4;
+  }
+  for (uint32_t v = p & ~bare; v; v &= v - 1) need += sizeof(float);
+  if (need != len) return BG_BAD_LENGTH;
+
+  // Commands that take a string argument are only accepted as text, and so are
+  // M108, M112, and M410, which only the emergency parser can act on at once.
+  if (letter(buf) == 'M') switch (codenum(buf)) {
+    case 16: case 23: case 28: case 30: case 32: case 33: case 117 ... 118: case 810 ... 819: case 928:
+    case 108: case 112: case 410:
+      return BG_BAD_FIELDS;
+    default: break;
+  }
+
+  return BG_OK;
+}
+
+bool BinaryGcode::line_number(const char * const buf, long &n) {
+  if (!(flags(buf) & BG_FLAG_LINE)) return false;
+  n = int32_t(get_u32(&buf[BG_HEADER_LEN + BG_PARAMS_LEN]));
+  return true;
+}
+
+void BinaryGcode::print(const char * const buf) {
+  const uint8_t f = flags(buf);
+  uint8_t i = BG_HEADER_LEN + BG_PARAMS_LEN;
+  long n;
+  if (line_number(buf, n)) { SERIAL_CHAR('N'); SERIAL_ECHO(n); SERIAL_CHAR(' '); i += 4; }
+  SERIAL_CHAR(letter(buf));
+  SERIAL_ECHO(codenum(buf));
+  if (f & BG_FLAG_SUB) { SERIAL_CHAR('.'); SERIAL_ECHO(int(uint8_t(buf[i++]))); }
+  uint32_t bare = 0;
+  if (f & BG_FLAG_BARE) { bare = get_u32(&buf[i]); i += 4; }
+  const uint32_t p = params(buf);
+  LOOP_L_N(b, 26) if (TEST32(p, b)) {
+    SERIAL_CHAR(' ', 'A' + b);
+    if (!TEST32(bare, b)) { SERIAL_DECIMAL(get_float(&buf[i])); i += sizeof(float); }
+  }
+  SERIAL_EOL();
+}
+
+#endif // BINARY_GCODE
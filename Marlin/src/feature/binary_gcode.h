@@ -0,0 +1,115 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * binary_gcode.h - Compact binary G-code frames
+ *
+ * A host or slicer may send any command with numeric parameters as a binary
+ * frame instead of a text line. The frame starts with BG_START (0xB5) where
+ * the first character of a line would be, so text lines pass through as usual
+ * and both forms can be mixed on one port or in one SD file.
+ *
+ * All fields are little-endian:
+ *
+ *   Offset  Size  Field
+ *   0       1     0xB5 - Start of frame
+ *   1       1     LEN - Bytes from CODE through the last value
+ *   2       2     CODE - Bits 0-13: Code number. Bits 14-15: Letter (0:G 1:M 2:T)
+ *   4       1     FLAGS - Bit 0: LINE follows. Bit 1: SUB follows. Bit 2: BARE follows.
+ *   5       4     PARAMS - Bit n is set for each parameter 'A'+n
+ *   [9]     4     LINE - Line number, checked like 'N' on a text line
+ *   [ ]     1     SUB - Subcode, as in G29.1
+ *   [ ]     4     BARE - PARAMS given without a value, as in 'G28 X'
+ *   [ ]     4*n   VALUES - One float for each of PARAMS not in BARE, A to Z
+ *   2+LEN   2     CRC-16/XMODEM of LEN through VALUES
+ *
+ * "G1 X12.3 Y45.6 E0.0321" is 23 bytes, and needs no float conversion.
+ *
+ * A validated frame is queued as-is and GCodeParser::parse hands it to
+ * parse_binary, which points the parameter table straight at the values.
+ * Commands that take a string argument (M23, M117, etc.) are text-only.
+ * The emergency parser skips frames whole, so M108, M112, and M410 are also
+ * text-only. Otherwise they would wait behind a full queue.
+ *
+ * buildroot/share/scripts/binary_gcode.py converts a G-code file to frames.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define BG_START      0xB5
+#define BG_HEADER_LEN 2   // START, LEN
+#define BG_PARAMS_LEN 7   // CODE, FLAGS, PARAMS
+#define BG_CRC_LEN    2
+
+#define BG_FLAG_LINE  _BV(0)
+#define BG_FLAG_SUB   _BV(1)
+#define BG_FLAG_BARE  _BV(2)
+
+// Frames are queued whole, and the parser keeps value offsets in a byte
+#define BG_MAX_FRAME  _MIN(MAX_CMD_SIZE, 256)
+#define BG_MAX_LEN    (BG_MAX_FRAME - (BG_HEADER_LEN) - (BG_CRC_LEN))
+
+class BinaryGcode {
+public:
+  enum Result : int8_t {
+    BG_PENDING,     // More bytes needed
+    BG_OK,          // Frame is complete and valid
+    BG_BAD_LENGTH,  // LEN is out of range or doesn't match the fields
+    BG_BAD_CRC,     // CRC mismatch
+    BG_BAD_FIELDS   // Unknown letter or flags, or a text-only command
+  };
+
+  // The buffer holds a frame (which can't be a text command)
+  static inline bool is_frame(const char * const buf) { return uint8_t(buf[0]) == BG_START; }
+
+  // Total size of a frame whose first two bytes have arrived
+  static inline uint16_t frame_size(const char * const buf) { return BG_HEADER_LEN + uint8_t(buf[1]) + BG_CRC_LEN; }
+
+  /**
+   * Add a byte to a frame being received, starting with BG_START.
+   * Return BG_PENDING until the frame is complete, then the result of validate().
+   */
+  static Result receive(char * const buf, int &count, const uint8_t c);
+
+  // Check the length, CRC, and fields of a complete frame
+  static Result validate(const char * const buf);
+
+  // Accessors for a validated frame
+  static inline char letter(const char * const buf) {
+    static const char letters[] PROGMEM = "GMT";
+    return pgm_read_byte(&letters[uint8_t(buf[3]) >> 6]);
+  }
+  static inline uint16_t codenum(const char * const buf) { return get_u16(&buf[2]) & 0x3FFF; }
+  static inline uint8_t flags(const char * const buf) { return buf[4]; }
+  static inline uint32_t params(const char * const buf) { return get_u32(&buf[5]); }
+
+  // Get the LINE field. Return false if the frame has none.
+  static bool line_number(const char * const buf, long &n);
+
+  // Echo a frame as the equivalent text command
+  static void print(const char * const buf);
+
+  static inline uint16_t get_u16(const char * const p) { uint16_t v; memcpy(&v, p, sizeof(v)); return v; }
+  static inline uint32_t get_u32(const char * const p) { uint32_t v; memcpy(&v, p, sizeof(v)); return v; }
+  static inline float get_float(const char * const p) { float v; memcpy(&v, p, sizeof(v)); return v; }
+};
@@ -35,12 +35,19 @@
 extern bool wait_for_user, wait_for_heatup;
 void quickstop_stepper();
 
+#if ENABLED(BINARY_GCODE)
+  // Binary frames are skipped whole. See binary_gcode.h.
+  #define EP_FRAME_START    0xB5
+  #define EP_FRAME_LEN_MIN  7
+  #define EP_FRAME_LEN_MAX  (_MIN(MAX_CMD_SIZE, 256) - 4)
+#endif
+
 class EmergencyParser {
 
 public:
 
   // Currently looking for: M108, M112, M410, M876
-  enum State : char {
+  enum State : TERN(BINARY_GCODE, uint16_t, char) {
     EP_RESET,
     EP_N,
     EP_M,
@@ -59,7 +66,13 @@ public:
       EP_M876S,
       EP_M876SN,
     #endif
+    #if ENABLED(BINARY_GCODE)
+      EP_FRAME_LEN, // Frame start seen, LEN is next
+    #endif
     EP_IGNORE // to '\n'
+    #if ENABLED(BINARY_GCODE)
+      , EP_FRAME    // In a frame, with (state - EP_FRAME) bytes to skip
+    #endif
   };
 
   static bool killed_by_M112;
@@ -76,16 +89,33 @@ public:
 
   FORCE_INLINE static void update(State &state, const uint8_t c) {
     #define ISEOL(C) ((C) == '\n' || (C) == '\r')
+    #if ENABLED(BINARY_GCODE)
+      // Keep frame bytes away from the parser, up to the end of the frame
+      if (state >= EP_FRAME) {
+        state = State(state - 1);
+        if (state == EP_FRAME) state = EP_RESET;
+        return;
+      }
+    #endif
     switch (state) {
       case EP_RESET:
         switch (c) {
           case ' ': case '\n': case '\r': break;
           case 'N': state = EP_N;      break;
           case 'M': state = EP_M;      break;
+          #if ENABLED(BINARY_GCODE)
+            case EP_FRAME_START: state = EP_FRAME_LEN; break;
+          #endif
           default: state  = EP_IGNORE;
         }
         break;
 
+      #if ENABLED(BINARY_GCODE)
+        case EP_FRAME_LEN: // Skip LEN bytes and the CRC
+          state = WITHIN(c, EP_FRAME_LEN_MIN, EP_FRAME_LEN_MAX) ? State(EP_FRAME + c + 2) : EP_IGNORE;
+          break;
+      #endif
+
       case EP_N:
         switch (c) {
           case '0' ... '9':
@@ -0,0 +1,95 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Event Trace
+ *
+ * Events are written with interrupts disabled, since the stepper ISR adds
+ * them too. The oldest event is overwritten when the ring is full. An idle
+ * event right after another one is added to it, so a waiting machine does
+ * not flush the ring in a few milliseconds.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(EVENT_TRACE)
+
+#include "event_trace.h"
+
+static_assert(sizeof(trace_record_t) == 8, "trace_record_t must be 8 bytes.");
+
+EventTrace event_trace;
+
+bool EventTrace::enabled = true;
+trace_record_t EventTrace::ring[EVENT_TRACE_SIZE];
+uint16_t EventTrace::head, EventTrace::count;
+
+void EventTrace::record(const TraceEvent e, const uint16_t value) {
+  const uint32_t now = micros();
+  CRITICAL_SECTION_START();
+  if (enabled) {
+    trace_record_t &last = ring[head ? head - 1 : EVENT_TRACE_SIZE - 1];
+    if (e == TRACE_IDLE && count && last.event == TRACE_IDLE && last.repeat < 0xFF && uint32_t(last.value) + value <= 0xFFFF) {
+      last.time_us = now;
+      last.value += value;
+      last.repeat++;
+    }
+    else {
+      trace_record_t &r = ring[head];
+      r.time_us = now;
+      r.event = e;
+      r.repeat = 0;
+      r.value = value;
+      if (++head >= EVENT_TRACE_SIZE) head = 0;
+      if (count < EVENT_TRACE_SIZE) count++;
+    }
+  }
+  CRITICAL_SECTION_END();
+}
+
+void EventTrace::reset() {
+  CRITICAL_SECTION_START();
+  head = count = 0;
+  CRITICAL_SECTION_END();
+}
+
+/**
+ * Send "Trace: <count>", a newline, then the records oldest first.
+ * Recording stops while the records are sent.
+ */
+void EventTrace::dump() {
+  const bool was_enabled = enabled;
+  enabled = false;
+
+  SERIAL_ECHOLNPAIR("Trace: ", count);
+  uint16_t i = (head + EVENT_TRACE_SIZE - count) % (EVENT_TRACE_SIZE);
+  for (uint16_t n = count; n--;) {
+    const uint8_t * const b = (const uint8_t*)&ring[i];
+    LOOP_L_N(j, sizeof(trace_record_t)) SERIAL_CHAR(b[j]);
+    if (++i >= EVENT_TRACE_SIZE) i = 0;
+  }
+  SERIAL_EOL();
+
+  enabled = was_enabled;
+}
+
+#endif // EVENT_TRACE
@@ -0,0 +1,76 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Event Trace
+ *
+ * A ring of timestamped planner, stepper, command queue, and idle() events,
+ * small enough to leave enabled on a production machine. Use it to tell a
+ * starved planner from a stalled host or a slow idle(). See M992.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+enum TraceEvent : uint8_t {
+  TRACE_BLOCK_QUEUED = 1,   // The planner added a block. Value: blocks in the planner
+  TRACE_BLOCK_START,        // The stepper started a block. Value: blocks in the planner
+  TRACE_BLOCK_DONE,         // The planner released a finished block. Value: blocks left
+  TRACE_COMMAND_QUEUE,      // A command was queued or taken. Value: commands in the queue
+  TRACE_IDLE                // idle() returned. Value: microseconds spent, up to 65535.
+                            // Back-to-back idle() calls share one record.
+};
+
+// 8 bytes, sent as-is (little-endian) by M992
+typedef struct {
+  uint32_t time_us;         // micros() at the event
+  uint8_t event;            // TraceEvent
+  uint8_t repeat;           // Idle calls merged into this record
+  uint16_t value;
+} trace_record_t;
+
+class EventTrace {
+public:
+  static bool enabled;
+
+  static void record(const TraceEvent e, const uint16_t value);
+  static void reset();
+  static void dump();
+
+  // Record the time spent in the enclosing scope
+  class Scope {
+  public:
+    Scope(const TraceEvent e) : event(e), start(micros()) {}
+    ~Scope() { const uint32_t us = micros() - start; record(event, us < 0xFFFF ? us : 0xFFFF); }
+  private:
+    const TraceEvent event;
+    const uint32_t start;
+  };
+
+private:
+  static trace_record_t ring[EVENT_TRACE_SIZE];
+  static uint16_t head, count;
+};
+
+extern EventTrace event_trace;
+
+#define EVENT_TRACE_SCOPE(E) EventTrace::Scope _event_trace_scope(TRACE_##E)
@@ -0,0 +1,88 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * G-code Profiler
+ *
+ * A small open-addressed hash table keyed by letter, code number, and subcode.
+ * Commands that don't fit once the table is full are only counted as dropped.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_PROFILER)
+
+#include "gcode_profiler.h"
+
+GcodeProfiler gcode_profiler;
+
+GcodeProfiler::entry_t GcodeProfiler::entry[GCODE_PROFILER_SLOTS];
+uint32_t GcodeProfiler::dropped;
+
+void GcodeProfiler::add(const char letter, const uint16_t codenum, const uint8_t subcode, const uint32_t us) {
+  uint8_t i = (uint16_t(letter) * 97U + codenum * 31U + subcode) % (GCODE_PROFILER_SLOTS);
+  LOOP_L_N(n, GCODE_PROFILER_SLOTS) {
+    entry_t &e = entry[i];
+    if (!e.letter) {
+      e.letter = letter;
+      e.codenum = codenum;
+      e.subcode = subcode;
+    }
+    if (e.letter == letter && e.codenum == codenum && e.subcode == subcode) {
+      e.count++;
+      e.total_us += us;
+      NOLESS(e.max_us, us);
+      return;
+    }
+    if (++i >= GCODE_PROFILER_SLOTS) i = 0;
+  }
+  dropped++;
+}
+
+void GcodeProfiler::reset() {
+  ZERO(entry);
+  dropped = 0;
+}
+
+/**
+ * Print the commands seen since the last reset, most total time first
+ */
+void GcodeProfiler::report() {
+  bool shown[GCODE_PROFILER_SLOTS] = { false };
+  SERIAL_ECHOLNPGM("G-code profile:");
+  for (;;) {
+    int16_t best = -1;
+    LOOP_L_N(i, GCODE_PROFILER_SLOTS)
+      if (entry[i].letter && !shown[i] && (best < 0 || entry[i].total_us > entry[best].total_us)) best = i;
+    if (best < 0) break;
+    shown[best] = true;
+
+    const entry_t &e = entry[best];
+    SERIAL_CHAR(' ', e.letter);
+    SERIAL_ECHO(e.codenum);
+    if (e.subcode) { SERIAL_CHAR('.'); SERIAL_ECHO(int(e.subcode)); }
+    SERIAL_ECHOLNPAIR(": n=", e.count, " total=", uint32_t(e.total_us / 1000), "ms mean=", uint32_t(e.total_us / e.count), "us max=", e.max_us, "us");
+  }
+  if (dropped) SERIAL_ECHOLNPAIR(" Dropped: ", dropped);
+}
+
+#endif // GCODE_PROFILER
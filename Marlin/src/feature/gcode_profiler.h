@@ -0,0 +1,52 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * G-code Profiler
+ *
+ * Count the calls to each G-code and the time spent in its handler,
+ * measured with micros() around the dispatch. Time spent in nested
+ * subcommands (e.g., G28 inside G29) is included in the outer command. See M991.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class GcodeProfiler {
+public:
+  typedef struct {
+    char letter;          // 'G', 'M', 'T', ... or 0 for a free slot
+    uint8_t subcode;
+    uint16_t codenum;
+    uint32_t count, max_us;
+    uint64_t total_us;
+  } entry_t;
+
+  static entry_t entry[GCODE_PROFILER_SLOTS];
+  static uint32_t dropped;  // Calls not recorded because the table was full
+
+  static void add(const char letter, const uint16_t codenum, const uint8_t subcode, const uint32_t us);
+  static void reset();
+  static void report();
+};
+
+extern GcodeProfiler gcode_profiler;
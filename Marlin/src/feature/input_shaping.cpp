@@ -0,0 +1,133 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * input_shaping.cpp - Input shaping of the X and Y step streams
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(INPUT_SHAPING)
+
+#include "input_shaping.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+
+InputShaping input_shaping;
+
+shaping_settings_t InputShaping::settings[XY];
+bool InputShaping::overflow_reported[XY];
+
+/**
+ * Impulse amplitudes and times for each shaper type, from the damped
+ * ringing frequency. Times are in units of the damped period 'td'.
+ * See Singer & Seering, "Preshaping Command Inputs to Reduce System Vibration".
+ */
+void StepShaper::set(const shaping_settings_t &s) {
+  float amp[1 + MAX_ECHOES] = { 1 }, t[1 + MAX_ECHOES] = { 0 };
+  uint8_t n = 1;
+
+  if (s.type != SHAPER_NONE && s.frequency > 0) {
+    const float df = SQRT(1.0f - sq(s.zeta)),
+                K = expf(-s.zeta * float(M_PI) / df),
+                td = 1.0f / (s.frequency * df);
+    switch (s.type) {
+      default: break;
+      case SHAPER_ZV:
+        n = 2;
+        amp[1] = K;
+        t[1] = 0.5f * td;
+        break;
+      case SHAPER_ZVD:
+        n = 3;
+        amp[1] = 2 * K;         amp[2] = sq(K);
+        t[1] = 0.5f * td;       t[2] = td;
+        break;
+      case SHAPER_MZV: {
+        const float K2 = expf(-0.75f * s.zeta * float(M_PI) / df),
+                    a1 = 1.0f - float(M_SQRT1_2);
+        n = 3;
+        amp[0] = a1;            amp[1] = (float(M_SQRT2) - 1.0f) * K2;  amp[2] = a1 * sq(K2);
+        t[1] = 0.375f * td;     t[2] = 0.75f * td;
+      } break;
+      case SHAPER_EI: {
+        constexpr float v_tol = 0.05f;
+        n = 3;
+        amp[0] = 0.25f * (1.0f + v_tol);
+        amp[1] = 0.5f * (1.0f - v_tol) * K;
+        amp[2] = amp[0] * sq(K);
+        t[1] = 0.5f * td;       t[2] = td;
+      } break;
+    }
+  }
+
+  float sum = 0;
+  LOOP_L_N(i, n) sum += amp[i];
+
+  // Round the echoes and give the remainder to the first impulse, for a whole step in total
+  int32_t rest = STEP_ONE;
+  echoes = n - 1;
+  LOOP_L_N(i, echoes) {
+    echo_amp[i] = LROUND(amp[i + 1] * STEP_ONE / sum);
+    echo_delay[i] = LROUND(t[i + 1] * (STEPPER_TIMER_RATE));
+    rest -= echo_amp[i];
+  }
+  first_amp = rest;
+
+  head = 0;
+  LOOP_L_N(i, MAX_ECHOES) cursor[i] = 0;
+  acc = 0;
+  overflows = 0;
+}
+
+void InputShaping::reset() {
+  settings[X_AXIS].type = (ShaperType)SHAPING_TYPE_X;
+  settings[X_AXIS].frequency = SHAPING_FREQ_X;
+  settings[X_AXIS].zeta = SHAPING_ZETA_X;
+  settings[Y_AXIS].type = (ShaperType)SHAPING_TYPE_Y;
+  settings[Y_AXIS].frequency = SHAPING_FREQ_Y;
+  settings[Y_AXIS].zeta = SHAPING_ZETA_Y;
+}
+
+void InputShaping::refresh() {
+  planner.synchronize();
+  LOOP_L_N(a, XY) {
+    stepper.set_shaping((AxisEnum)a, settings[a]);
+    overflow_reported[a] = false;
+  }
+}
+
+void InputShaping::check_overflows() {
+  LOOP_L_N(a, XY) if (!overflow_reported[a] && stepper.shaper[a].overflows) {
+    overflow_reported[a] = true;
+    SERIAL_ECHO_START();
+    SERIAL_CHAR(axis_codes[a]);
+    SERIAL_ECHOLNPGM(" shaper overflow. Steps were released early. Raise SHAPING_BUFFER_SIZE.");
+  }
+}
+
+uint32_t InputShaping::steps_in_delay(const AxisEnum axis) {
+  return CEIL(planner.settings.max_feedrate_mm_s[axis] * planner.settings.axis_steps_per_mm[axis]
+              * stepper.shaper[axis].last_delay() / float(STEPPER_TIMER_RATE));
+}
+
+#endif // INPUT_SHAPING
@@ -0,0 +1,182 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * input_shaping.h - Input shaping of the X and Y step streams
+ *
+ * Every step the Stepper generates for X or Y is split into two or three
+ * impulses. The first is applied at once and the others are replayed later
+ * from a small ring of delayed steps, so the frame is excited by a command
+ * that cancels its own ringing at the tuned frequency.
+ *
+ * Impulse amplitudes are kept in 1/65536 step units and always add up to a
+ * whole step, so the axis ends on the exact commanded position.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#ifdef SHAPING_BUFFER_SIZE
+  constexpr uint16_t shaping_buffer_size = SHAPING_BUFFER_SIZE;
+#else
+  // The longest echo delay is at most one damped period. Fit the steps the
+  // faster of X and Y takes in that time at its default max feedrate.
+  constexpr float shaping_steps_mm[] = DEFAULT_AXIS_STEPS_PER_UNIT, shaping_max_fr[] = DEFAULT_MAX_FEEDRATE,
+                  shaping_period_x = 1.0f / (SHAPING_FREQ_X * SQRT(1.0f - sq(float(SHAPING_ZETA_X)))),
+                  shaping_period_y = 1.0f / (SHAPING_FREQ_Y * SQRT(1.0f - sq(float(SHAPING_ZETA_Y))));
+  constexpr uint16_t shaping_buffer_size = 16 + 1.1f * _MAX(
+    shaping_steps_mm[X_AXIS] * shaping_max_fr[X_AXIS] * shaping_period_x,
+    shaping_steps_mm[Y_AXIS] * shaping_max_fr[Y_AXIS] * shaping_period_y
+  );
+  static_assert(shaping_buffer_size <= 4096, "Input shaping needs over 4096 delayed steps per axis at the default max feedrate. Lower DEFAULT_MAX_FEEDRATE or set SHAPING_BUFFER_SIZE.");
+#endif
+
+enum ShaperType : uint8_t {
+  SHAPER_NONE,  // Pass steps through unchanged
+  SHAPER_ZV,    // Zero Vibration, 2 impulses over 1/2 period
+  SHAPER_ZVD,   // Zero Vibration and Derivative, 3 impulses over 1 period
+  SHAPER_MZV,   // Modified ZV, 3 impulses over 3/4 period
+  SHAPER_EI,    // Extra-Insensitive (5% vibration tolerance), 3 impulses over 1 period
+  SHAPER_COUNT
+};
+
+typedef struct {
+  ShaperType type;  // M593 T - Shaper type
+  float frequency,  // M593 F - Ringing frequency to cancel (Hz)
+        zeta;       // M593 D - Damping ratio of the ringing
+} shaping_settings_t;
+
+/**
+ * Delayed-step ring for one axis.
+ *
+ * The ring holds the time and direction of recent steps, one word each. Each echo impulse
+ * keeps its own read cursor into the ring, and the slot is reused once the
+ * last (longest delayed) echo has replayed it. The ISR cost per step is one
+ * push plus one replay per echo.
+ */
+class StepShaper {
+public:
+  static constexpr int32_t STEP_ONE = 0x10000, STEP_HALF = STEP_ONE / 2;
+  static constexpr uint32_t NEVER = 0xFFFFFFFF;
+  static constexpr uint8_t MAX_ECHOES = 2;
+
+  uint16_t overflows;       // Steps whose echoes were applied early because the ring was full
+
+  StepShaper() { set({ SHAPER_NONE, 0, 0 }); }
+
+  // Compute the impulses. Call only while the ring is empty.
+  void set(const shaping_settings_t &s);
+
+  FORCE_INLINE bool busy() const { return head != tail(); }
+
+  // Delay of the first echo, in stepper timer ticks
+  FORCE_INLINE uint32_t first_delay() const { return echoes ? echo_delay[0] : NEVER; }
+
+  // Delay of the last echo, in stepper timer ticks. Steps taken in this time must fit the ring.
+  FORCE_INLINE uint32_t last_delay() const { return echoes ? echo_delay[echoes - 1] : 0; }
+
+  // Add a step from the step generator, taken at 'now' (stepper timer ticks)
+  FORCE_INLINE void push(const uint32_t now, const int8_t dir) {
+    acc += dir > 0 ? first_amp : -first_amp;
+    if (!echoes) return;
+    const uint16_t next = next_index(head);
+    if (next == tail()) flush_oldest();
+    ring[head] = (now & ~1UL) | (dir > 0);   // Time, with the direction in bit 0
+    head = next;
+  }
+
+  // Add a step that skips shaping (e.g., for homing)
+  FORCE_INLINE void push_unshaped(const int8_t dir) { acc += dir > 0 ? STEP_ONE : -STEP_ONE; }
+
+  // Apply the echoes due at 'now'. Return the ticks until the next echo.
+  uint32_t replay(const uint32_t now) {
+    uint32_t next = NEVER;
+    for (uint8_t i = 0; i < echoes; ++i) {
+      uint16_t c = cursor[i];
+      while (c != head) {
+        const int32_t wait = int32_t((ring[c] & ~1UL) + echo_delay[i] - now);
+        if (wait > 0) { NOMORE(next, uint32_t(wait)); break; }
+        acc += TEST(ring[c], 0) ? echo_amp[i] : -echo_amp[i];
+        c = next_index(c);
+      }
+      cursor[i] = c;
+    }
+    return next;
+  }
+
+  // Take one whole step from the accumulated impulses. Return its direction, or 0 for none.
+  FORCE_INLINE int8_t step_due() {
+    if (acc > STEP_HALF) { acc -= STEP_ONE; return 1; }
+    if (acc < -STEP_HALF) { acc += STEP_ONE; return -1; }
+    return 0;
+  }
+
+  // Another whole step is due, as after an overflow
+  FORCE_INLINE bool step_pending() const { return acc > STEP_HALF || acc < -STEP_HALF; }
+
+private:
+  uint32_t ring[shaping_buffer_size];
+  uint16_t head, cursor[MAX_ECHOES];
+  uint8_t echoes;
+  int32_t acc, first_amp, echo_amp[MAX_ECHOES];
+  uint32_t echo_delay[MAX_ECHOES];
+
+  static FORCE_INLINE uint16_t next_index(const uint16_t i) { return i + 1 < shaping_buffer_size ? i + 1 : 0; }
+
+  // The last echo has the longest delay, so its cursor marks the oldest step
+  FORCE_INLINE uint16_t tail() const { return echoes ? cursor[echoes - 1] : head; }
+
+  // Apply the remaining echoes of the oldest step now to make room
+  void flush_oldest() {
+    const uint16_t t = tail();
+    for (uint8_t i = 0; i < echoes; ++i) if (cursor[i] == t) {
+      acc += TEST(ring[t], 0) ? echo_amp[i] : -echo_amp[i];
+      cursor[i] = next_index(t);
+    }
+    overflows++;
+  }
+};
+
+#if ENABLED(INPUT_SHAPING)
+
+class InputShaping {
+public:
+  static shaping_settings_t settings[XY];   // M593 X Y
+
+  static void reset();
+
+  // Wait for motion to finish and hand the settings to the Stepper
+  static void refresh();
+
+  // Warn once after refresh() if an axis ring has overflowed
+  static void check_overflows();
+
+  // Steps the axis can take at its max feedrate during the longest echo delay
+  static uint32_t steps_in_delay(const AxisEnum axis);
+
+private:
+  static bool overflow_reported[XY];
+};
+
+extern InputShaping input_shaping;
+
+#endif // INPUT_SHAPING
@@ -117,31 +117,27 @@ void GcodeSuite::G35() {
   // Home all before this procedure
   home_all_axes();
 
-  bool err_break = false;
+  // In BLTOUCH HS mode, the probe travels in a deployed state.
+  // Users of G35 might have a badly misaligned bed, so raise Z by the
+  // length of the deployed pin (BLTOUCH stroke < 7mm)
+  const float travel_z = (Z_CLEARANCE_BETWEEN_PROBES) + (7 * ENABLED(BLTOUCH_HS_MODE));
+  current_position.z = travel_z;
 
   // Probe all positions
-  LOOP_L_N(i, G35_PROBE_COUNT) {
+  const bool err_break = isnan(probe.probe_points(screws_tilt_adjust_pos, z_measured, G35_PROBE_COUNT, PROBE_PT_RAISE, 0, true, true, travel_z));
 
-    // In BLTOUCH HS mode, the probe travels in a deployed state.
-    // Users of G35 might have a badly misaligned bed, so raise Z by the
-    // length of the deployed pin (BLTOUCH stroke < 7mm)
-    current_position.z = (Z_CLEARANCE_BETWEEN_PROBES) + (7 * ENABLED(BLTOUCH_HS_MODE));
-
-    const float z_probed_height = probe.probe_at_point(screws_tilt_adjust_pos[i], PROBE_PT_RAISE, 0, true);
-
-    if (isnan(z_probed_height)) {
+  if (err_break) {
+    LOOP_L_N(i, G35_PROBE_COUNT) if (isnan(z_measured[i])) {
       SERIAL_ECHOPAIR("G35 failed at point ", int(i), " (", tramming_point_name[i], ")");
       SERIAL_ECHOLNPAIR_P(SP_X_STR, screws_tilt_adjust_pos[i].x, SP_Y_STR, screws_tilt_adjust_pos[i].y);
-      err_break = true;
       break;
     }
-
-    if (DEBUGGING(LEVELING)) {
+  }
+  else if (DEBUGGING(LEVELING)) {
+    LOOP_L_N(i, G35_PROBE_COUNT) {
       DEBUG_ECHOPAIR("Probing point ", int(i), " (", tramming_point_name[i], ")");
-      SERIAL_ECHOLNPAIR_P(SP_X_STR, screws_tilt_adjust_pos[i].x, SP_Y_STR, screws_tilt_adjust_pos[i].y, SP_Z_STR, z_probed_height);
+      SERIAL_ECHOLNPAIR_P(SP_X_STR, screws_tilt_adjust_pos[i].x, SP_Y_STR, screws_tilt_adjust_pos[i].y, SP_Z_STR, z_measured[i]);
     }
-
-    z_measured[i] = z_probed_height;
   }
 
   if (!err_break) {
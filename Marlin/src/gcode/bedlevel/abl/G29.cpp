@@ -603,6 +603,8 @@ G29_TYPE GcodeSuite::G29() {
 
       xy_int8_t meshCount;
 
+      TERN_(PROBE_FAST_SCAN, probe.scan_start());
+
       // Outer loop is X with PROBE_Y_FIRST enabled
       // Outer loop is Y with PROBE_Y_FIRST disabled
       for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_END && !isnan(measured_z); PR_OUTER_VAR++) {
@@ -675,24 +677,37 @@ G29_TYPE GcodeSuite::G29() {
         } // inner
       } // outer
 
+      TERN_(PROBE_FAST_SCAN, probe.scan_end());
+
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
-      // Probe at 3 arbitrary points
+      // Probe at 3 arbitrary points, in travel order
 
+      if (verbose_level) SERIAL_ECHOLNPGM("Probing 3 points.");
+
+      xy_pos_t probe_xy[3];
+      float probe_z[3];
       LOOP_L_N(i, 3) {
-        if (verbose_level) SERIAL_ECHOLNPAIR("Probing point ", int(i + 1), "/3.");
-        TERN_(HAS_DISPLAY, ui.status_printf_P(0, PSTR(S_FMT " %i/3"), GET_TEXT(MSG_PROBING_MESH), int(i + 1)));
+        probe_xy[i] = points[i];
+        probe_z[i] = faux ? 0.001 * random(-100, 101) : 0;
+      }
 
-        // Retain the last probe position
-        probePos = points[i];
-        measured_z = faux ? 0.001 * random(-100, 101) : probe.probe_at_point(probePos, raise_after, verbose_level);
-        if (isnan(measured_z)) {
-          set_bed_leveling_enabled(abl_should_enable);
-          break;
-        }
-        points[i].z = measured_z;
+      // Retain the last probe position and Z
+      if (faux) {
+        probePos = probe_xy[2];
+        measured_z = probe_z[2];
+      }
+      else {
+        measured_z = probe.probe_points(probe_xy, probe_z, 3, raise_after, verbose_level, true, true, 0, TERN(HAS_DISPLAY, GET_TEXT(MSG_PROBING_MESH), nullptr));
+        probePos = current_position;
+        probePos += probe.offset_xy;
       }
 
+      if (isnan(measured_z))
+        set_bed_leveling_enabled(abl_should_enable);
+      else
+        LOOP_L_N(i, 3) points[i].z = probe_z[i];
+
       if (!dryrun && !isnan(measured_z)) {
         vector_3 planeNormal = vector_3::cross(points[0] - points[1], points[2] - points[1]).get_normal();
         if (planeNormal.z < 0) planeNormal *= -1;
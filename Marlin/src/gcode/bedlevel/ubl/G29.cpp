@@ -31,6 +31,9 @@
 #include "../../gcode.h"
 #include "../../../feature/bedlevel/bedlevel.h"
 
-void GcodeSuite::G29() { ubl.G29(); }
+void GcodeSuite::G29() {
+  ubl.G29();
+  TERN_(UBL_CELL_CACHE, ubl.refresh_cell_cache());
+}
 
 #endif // AUTO_BED_LEVELING_UBL
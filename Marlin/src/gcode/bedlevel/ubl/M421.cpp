@@ -63,6 +63,7 @@ void GcodeSuite::M421() {
   else {
     float &zval = ubl.z_values[ij.x][ij.y];
     zval = hasN ? NAN : parser.value_linear_units() + (hasQ ? zval : 0);
+    TERN_(UBL_CELL_CACHE, ubl.refresh_cell_cache(ij.x, ij.y));
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ij.x, ij.y, zval));
   }
 }
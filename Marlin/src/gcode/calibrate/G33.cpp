@@ -169,14 +169,15 @@ static float std_dev_points(float z_pt[NPP + 1], const bool _0p_cal, const bool
 }
 
 /**
- *  - Probe a point
+ *  - Probe a set of points, in travel order with a probe
  */
-static float calibration_probe(const xy_pos_t &xy, const bool stow) {
+static bool calibration_probe(const xy_pos_t xy[], float z[], const uint8_t count, const bool stow) {
   #if HAS_BED_PROBE
-    return probe.probe_at_point(xy, stow ? PROBE_PT_STOW : PROBE_PT_RAISE, 0, true, false);
+    return !isnan(probe.probe_points(xy, z, count, stow ? PROBE_PT_STOW : PROBE_PT_RAISE, 0, true, false));
   #else
     UNUSED(stow);
-    return lcd_probe_pt(xy);
+    LOOP_L_N(i, count) if (isnan(z[i] = lcd_probe_pt(xy[i]))) return false;
+    return true;
   #endif
 }
 
@@ -205,13 +206,17 @@ static bool probe_calibration_points(float z_pt[NPP + 1], const int8_t probe_poi
 
   if (!_0p_calibration) {
 
+    // Points are probed together, in travel order, in batches of up to one sector of the densest pattern
+    constexpr uint8_t max_points = 15;
+    static_assert(max_points >= 10, "G33 needs room for the 10 points of the P8-P10 center pass.");
+    xy_pos_t xy[max_points];
+    float z[max_points];
+    uint8_t count = 0;
+
     const float dcr = delta_calibration_radius();
 
-    if (!_7p_no_intermediates && !_7p_4_intermediates && !_7p_11_intermediates) { // probe the center
-      const xy_pos_t center{0};
-      z_pt[CEN] += calibration_probe(center, stow_after_each);
-      if (isnan(z_pt[CEN])) return false;
-    }
+    if (!_7p_no_intermediates && !_7p_4_intermediates && !_7p_11_intermediates) // probe the center
+      xy[count++].set(0, 0);
 
     if (_7p_calibration) { // probe extra center points
       const float start  = _7p_9_center ? float(_CA) + _7P_STEP / 3.0f : _7p_6_center ? float(_CA) : float(__C),
@@ -220,10 +225,14 @@ static bool probe_calibration_points(float z_pt[NPP + 1], const int8_t probe_poi
         const float a = RADIANS(210 + (360 / NPP) *  (rad - 1)),
                     r = dcr * 0.1;
         const xy_pos_t vec = { cos(a), sin(a) };
-        z_pt[CEN] += calibration_probe(vec * r, stow_after_each);
-        if (isnan(z_pt[CEN])) return false;
-     }
-      z_pt[CEN] /= float(_7p_2_intermediates ? 7 : probe_points);
+        xy[count++] = vec * r;
+      }
+    }
+
+    if (count) {
+      if (!calibration_probe(xy, z, count, stow_after_each)) return false;
+      LOOP_L_N(i, count) z_pt[CEN] += z[i];
+      if (_7p_calibration) z_pt[CEN] /= float(_7p_2_intermediates ? 7 : probe_points);
     }
 
     if (!_1p_calibration) {  // probe the radius
@@ -237,22 +246,33 @@ static bool probe_calibration_points(float z_pt[NPP + 1], const int8_t probe_poi
                              _7p_1_intermediates  ? _7P_STEP /  2.0f : //  2r * 6 +  4c = 16
                              _7p_no_intermediates ? _7P_STEP :        //  1r * 6 +  3c = 9
                              _4P_STEP;                                // .5r * 6 +  1c = 4
-      bool zig_zag = true;
-      F_LOOP_CAL_PT(rad, start, _7p_9_center ? steps * 3 : steps) {
-        const int8_t offset = _7p_9_center ? 2 : 0;
-        for (int8_t circle = 0; circle <= offset; circle++) {
-          const float a = RADIANS(210 + (360 / NPP) *  (rad - 1)),
-                      r = dcr * (1 - 0.1 * (zig_zag ? offset - circle : circle)),
-                      interpol = FMOD(rad, 1);
+      const float rad_step = _7p_9_center ? steps * 3 : steps;
+      const int8_t offset = _7p_9_center ? 2 : 0;
+
+      // Point n of the pass is on circle (n % circles) at angle (n / circles), zig-zagging in and out
+      const uint8_t circles = offset + 1;
+      #define PASS_RAD(N) (start + ((N) / circles) * rad_step)
+
+      for (uint8_t n = 0; PASS_RAD(n) < NPP + 0.9999; n += count) {
+        for (count = 0; count < max_points && PASS_RAD(n + count) < NPP + 0.9999; count++) {
+          const uint8_t k = n + count, circle = k % circles;
+          const bool zig_zag = !((k / circles) & 1);
+          const float a = RADIANS(210 + (360 / NPP) *  (PASS_RAD(k) - 1)),
+                      r = dcr * (1 - 0.1 * (zig_zag ? offset - circle : circle));
           const xy_pos_t vec = { cos(a), sin(a) };
-          const float z_temp = calibration_probe(vec * r, stow_after_each);
-          if (isnan(z_temp)) return false;
+          xy[count] = vec * r;
+        }
+
+        if (!calibration_probe(xy, z, count, stow_after_each)) return false;
+
+        LOOP_L_N(i, count) {
           // split probe point to neighbouring calibration points
-          z_pt[uint8_t(LROUND(rad - interpol + NPP - 1)) % NPP + 1] += z_temp * sq(cos(RADIANS(interpol * 90)));
-          z_pt[uint8_t(LROUND(rad - interpol))           % NPP + 1] += z_temp * sq(sin(RADIANS(interpol * 90)));
+          const float rad = PASS_RAD(n + i), interpol = FMOD(rad, 1);
+          z_pt[uint8_t(LROUND(rad - interpol + NPP - 1)) % NPP + 1] += z[i] * sq(cos(RADIANS(interpol * 90)));
+          z_pt[uint8_t(LROUND(rad - interpol))           % NPP + 1] += z[i] * sq(sin(RADIANS(interpol * 90)));
         }
-        zig_zag = !zig_zag;
       }
+
       if (_7p_intermed_points)
         LOOP_CAL_RAD(rad)
           z_pt[rad] /= _7P_STEP / steps;
@@ -183,41 +183,34 @@ void GcodeSuite::G34() {
       z_measured_min =  100000.0f;
       float z_measured_max = -100000.0f;
 
-      // Probe all positions (one per Z-Stepper)
-      LOOP_L_N(i, NUM_Z_STEPPER_DRIVERS) {
-        // iteration odd/even --> downward / upward stepper sequence
-        const uint8_t iprobe = (iteration & 1) ? NUM_Z_STEPPER_DRIVERS - 1 - i : i;
-
-        // Safe clearance even on an incline
-        if ((iteration == 0 || i > 0) && z_probe > current_position.z) do_blocking_move_to_z(z_probe);
+      // Probe all positions (one per Z-Stepper), in travel order from the last one
+      // Safe clearance even on an incline
+      if (iteration == 0 && z_probe > current_position.z) do_blocking_move_to_z(z_probe);
+
+      // Probing sanity check is disabled, as it would trigger even in normal cases because
+      // current_position.z has been manually altered in the "dirty trick" above.
+      if (isnan(probe.probe_points(z_stepper_align.xy, z_measured, NUM_Z_STEPPER_DRIVERS, raise_after, 0, true, false, z_probe))) {
+        SERIAL_ECHOLNPGM("Probing failed");
+        LCD_MESSAGEPGM(MSG_LCD_PROBING_FAILED);
+        err_break = true;
+        break;
+      }
 
+      LOOP_L_N(i, NUM_Z_STEPPER_DRIVERS) {
         if (DEBUGGING(LEVELING))
-          DEBUG_ECHOLNPAIR_P(PSTR("Probing X"), z_stepper_align.xy[iprobe].x, SP_Y_STR, z_stepper_align.xy[iprobe].y);
-
-        // Probe a Z height for each stepper.
-        // Probing sanity check is disabled, as it would trigger even in normal cases because
-        // current_position.z has been manually altered in the "dirty trick" above.
-        const float z_probed_height = probe.probe_at_point(z_stepper_align.xy[iprobe], raise_after, 0, true, false);
-        if (isnan(z_probed_height)) {
-          SERIAL_ECHOLNPGM("Probing failed");
-          LCD_MESSAGEPGM(MSG_LCD_PROBING_FAILED);
-          err_break = true;
-          break;
-        }
+          DEBUG_ECHOLNPAIR_P(PSTR("Probed X"), z_stepper_align.xy[i].x, SP_Y_STR, z_stepper_align.xy[i].y);
 
         // Add height to each value, to provide a more useful target height for
         // the next iteration of probing. This allows adjustments to be made away from the bed.
-        z_measured[iprobe] = z_probed_height + Z_CLEARANCE_BETWEEN_PROBES;
+        z_measured[i] += Z_CLEARANCE_BETWEEN_PROBES;
 
-        if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("> Z", int(iprobe + 1), " measured position is ", z_measured[iprobe]);
+        if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("> Z", int(i + 1), " measured position is ", z_measured[i]);
 
         // Remember the minimum measurement to calculate the correction later on
-        z_measured_min = _MIN(z_measured_min, z_measured[iprobe]);
-        z_measured_max = _MAX(z_measured_max, z_measured[iprobe]);
+        z_measured_min = _MIN(z_measured_min, z_measured[i]);
+        z_measured_max = _MAX(z_measured_max, z_measured[i]);
       } // for (i)
 
-      if (err_break) break;
-
       // Adapt the next probe clearance height based on the new measurements.
       // Safe_height = lowest distance to bed (= highest measurement) plus highest measured misalignment.
       z_maxdiff = z_measured_max - z_measured_min;
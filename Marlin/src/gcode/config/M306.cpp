@@ -0,0 +1,97 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MPCTEMP)
+
+#include "../gcode.h"
+#include "../../lcd/ultralcd.h"
+#include "../../module/temperature.h"
+
+/**
+ * M306: Set or tune the hotend thermal model for MPC
+ *
+ *   E[extruder] Default: the active extruder
+ *
+ *   T           Autotune the model at MPC_TUNING_TEMP and apply the result
+ *
+ *   P[float] Heater power (W)
+ *   C[float] Heat block heat capacity (J/K)
+ *   R[float] Sensor responsiveness (1/s)
+ *   A[float] Ambient heat transfer coefficient with the fan off (W/K)
+ *   F[float] Ambient heat transfer coefficient with the fan on full (W/K)
+ *   H[float] Filament heat capacity per mm (J/K/mm)
+ */
+void GcodeSuite::M306() {
+
+  const uint8_t e = TERN(HAS_MULTI_HOTEND, parser.byteval('E', active_extruder), 0);
+  if (e >= HOTENDS) {
+    SERIAL_ERROR_MSG(STR_INVALID_EXTRUDER);
+    return;
+  }
+
+  if (parser.seen('T')) {
+    #if DISABLED(BUSY_WHILE_HEATING)
+      KEEPALIVE_STATE(NOT_BUSY);
+    #endif
+    ui.set_status(GET_TEXT(MSG_MPC_AUTOTUNE));
+    thermalManager.MPC_autotune(e);
+    ui.reset_status();
+    return;
+  }
+
+  MPC_t &constants = thermalManager.temp_hotend[e].constants;
+  if (parser.seen("PCRAFH")) {
+    const float power = parser.floatval('P', constants.heater_power),
+                capacity = parser.floatval('C', constants.block_heat_capacity),
+                responsiveness = parser.floatval('R', constants.sensor_responsiveness),
+                fan0 = parser.floatval('A', constants.ambient_xfer_coeff_fan0),
+                fan255 = parser.floatval('F', constants.ambient_xfer_coeff_fan0 + constants.fan255_adjustment),
+                filament = parser.floatval('H', constants.filament_heat_capacity_permm);
+
+    // The model divides by P and C, and the others make no sense below zero. H 0 ignores the filament.
+    if (power <= 0 || capacity <= 0 || responsiveness <= 0 || fan0 <= 0 || fan255 <= 0 || filament < 0) {
+      SERIAL_ERROR_MSG("?P, C, R, A, and F must be greater than 0. H must not be negative.");
+      return;
+    }
+
+    constants.heater_power = power;
+    constants.block_heat_capacity = capacity;
+    constants.sensor_responsiveness = responsiveness;
+    constants.ambient_xfer_coeff_fan0 = fan0;
+    constants.fan255_adjustment = fan255 - fan0;
+    constants.filament_heat_capacity_permm = filament;
+    return;
+  }
+
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPAIR("MPC E", int(e));
+  SERIAL_ECHOPAIR_F(" P", constants.heater_power, 2);
+  SERIAL_ECHOPAIR_F(" C", constants.block_heat_capacity, 2);
+  SERIAL_ECHOPAIR_F(" R", constants.sensor_responsiveness, 4);
+  SERIAL_ECHOPAIR_F(" A", constants.ambient_xfer_coeff_fan0, 4);
+  SERIAL_ECHOPAIR_F(" F", constants.ambient_xfer_coeff_fan0 + constants.fan255_adjustment, 4);
+  SERIAL_ECHOLNPAIR_F(" H", constants.filament_heat_capacity_permm, 6);
+}
+
+#endif // MPCTEMP
@@ -71,6 +71,14 @@ void GcodeSuite::M111() {
       #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
         SERIAL_ECHOPAIR("\nMax RX Queue Size: ", MYSERIAL0.rxMaxEnqueued());
       #endif
+
+      #if ENABLED(SERIAL_STATS_TX_BLOCKED)
+        SERIAL_ECHOPAIR("\nTX Blocked ms: ", MYSERIAL0.tx_blocked_ms());
+      #endif
+
+      #ifdef SERIAL_DROP_AUTO_REPORTS
+        SERIAL_ECHOPAIR("\nDropped Reports: ", serial_dropped_reports);
+      #endif
     #endif // !IS_AT90USB
   }
   SERIAL_EOL();
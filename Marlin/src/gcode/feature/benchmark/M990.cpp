@@ -0,0 +1,45 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(MOTION_BENCHMARK)
+
+#include "../../gcode.h"
+#include "../../../feature/benchmark.h"
+
+/**
+ * M990: Report the motion benchmark (segments, blocks, planner passes, float parsing, stage timing histograms)
+ *
+ *  R - Reset the counters instead of reporting
+ *
+ * Example, replaying a file on the linux_native simulator:
+ *   M990 R, <G-code>, M400, M990
+ */
+void GcodeSuite::M990() {
+  if (parser.seen('R'))
+    motion_benchmark.reset();
+  else
+    motion_benchmark.report();
+}
+
+#endif // MOTION_BENCHMARK
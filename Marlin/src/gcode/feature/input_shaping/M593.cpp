@@ -0,0 +1,87 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(INPUT_SHAPING)
+
+#include "../../gcode.h"
+#include "../../../feature/input_shaping.h"
+#include "../../../module/stepper.h"
+
+static void M593_report(const AxisEnum axis) {
+  const shaping_settings_t &s = input_shaping.settings[axis];
+  SERIAL_ECHO_START();
+  SERIAL_CHAR(axis_codes[axis]);
+  SERIAL_ECHOLNPAIR(" shaper T", int(s.type), " F", s.frequency, " D", s.zeta, " overflows:", stepper.shaper[axis].overflows);
+}
+
+/**
+ * M593: Get or set X/Y input shaping
+ *
+ *  X, Y      Axes to set. (Default: both)
+ *  T<type>   Shaper type: 0=None 1=ZV 2=ZVD 3=MZV 4=EI
+ *  F<hz>     Ringing frequency to cancel
+ *  D<zeta>   Damping ratio of the ringing (0-0.99)
+ *
+ * With no parameters, report the settings and the count of steps whose
+ * echoes were applied early because SHAPING_BUFFER_SIZE was too small.
+ * After a change, warn if the steps taken at the max feedrate during the
+ * longest echo delay won't fit the buffer.
+ */
+void GcodeSuite::M593() {
+  const bool seen_x = parser.seen('X'), seen_y = parser.seen('Y'),
+             all = !seen_x && !seen_y;
+
+  if (!parser.seen("TFD")) {
+    if (all || seen_x) M593_report(X_AXIS);
+    if (all || seen_y) M593_report(Y_AXIS);
+    return;
+  }
+
+  LOOP_L_N(a, XY) {
+    if (!all && !parser.seen(axis_codes[a])) continue;
+    shaping_settings_t &s = input_shaping.settings[a];
+    if (parser.seenval('T')) {
+      const uint8_t t = parser.value_byte();
+      if (t < SHAPER_COUNT) s.type = (ShaperType)t; else SERIAL_ECHOLNPGM("?T value out of range (0-4).");
+    }
+    if (parser.seenval('F')) {
+      const float f = parser.value_float();
+      if (f > 0) s.frequency = f; else SERIAL_ECHOLNPGM("?F value must be > 0.");
+    }
+    if (parser.seenval('D')) {
+      const float d = parser.value_float();
+      if (WITHIN(d, 0, 0.99f)) s.zeta = d; else SERIAL_ECHOLNPGM("?D value out of range (0-0.99).");
+    }
+  }
+
+  input_shaping.refresh();
+
+  LOOP_L_N(a, XY) if (input_shaping.steps_in_delay((AxisEnum)a) > shaping_buffer_size) {
+    SERIAL_ECHO_START();
+    SERIAL_CHAR(axis_codes[a]);
+    SERIAL_ECHOLNPAIR(" shaper may overflow at max feedrate. Steps in delay:", input_shaping.steps_in_delay((AxisEnum)a), " Buffer:", shaping_buffer_size);
+  }
+}
+
+#endif // INPUT_SHAPING
@@ -0,0 +1,42 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_PROFILER)
+
+#include "../../gcode.h"
+#include "../../../feature/gcode_profiler.h"
+
+/**
+ * M991: Report the G-code profile (calls, total, mean, and max handler time per command)
+ *
+ *  R - Reset the profile instead of reporting
+ */
+void GcodeSuite::M991() {
+  if (parser.seen('R'))
+    gcode_profiler.reset();
+  else
+    gcode_profiler.report();
+}
+
+#endif // GCODE_PROFILER
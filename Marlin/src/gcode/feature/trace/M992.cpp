@@ -0,0 +1,45 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(EVENT_TRACE)
+
+#include "../../gcode.h"
+#include "../../../feature/event_trace.h"
+
+/**
+ * M992: Send the event trace in binary, oldest event first.
+ *       Convert a capture with buildroot/share/scripts/event_trace.py
+ *
+ *  R    - Clear the trace instead of sending it
+ *  S<0|1> - Stop or start recording
+ */
+void GcodeSuite::M992() {
+  if (parser.seen('S')) event_trace.enabled = parser.value_bool();
+  if (parser.seen('R'))
+    event_trace.reset();
+  else if (!parser.seen('S'))
+    event_trace.dump();
+}
+
+#endif // EVENT_TRACE
@@ -61,6 +61,14 @@ GcodeSuite gcode;
   #include "../feature/password/password.h"
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  #include "../feature/binary_gcode.h"
+#endif
+
+#if ENABLED(GCODE_PROFILER)
+  #include "../feature/gcode_profiler.h"
+#endif
+
 #include "../MarlinCore.h" // for idle()
 
 // Inactivity shutdown
@@ -90,11 +98,56 @@ uint8_t GcodeSuite::axis_relative = (
   GcodeSuite::WorkspacePlane GcodeSuite::workspace_plane = PLANE_XY;
 #endif
 
+#ifdef ARC_CHORD_TOLERANCE
+  float GcodeSuite::arc_chord_tolerance = ARC_CHORD_TOLERANCE;
+  uint16_t GcodeSuite::arc_segment_time = ARC_SEGMENT_MIN_TIME,
+           GcodeSuite::arc_segments; // = 0
+#endif
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
   int8_t GcodeSuite::active_coordinate_system = -1; // machine space
   xyz_pos_t GcodeSuite::coordinate_system[MAX_COORDINATE_SYSTEMS];
 #endif
 
+#if ENABLED(GCODE_HANDLER_REGISTRY)
+
+  GcodeSuite::registry_entry_t GcodeSuite::registry[GCODE_REGISTRY_SIZE];
+  uint8_t GcodeSuite::registry_count; // = 0
+
+  /**
+   * Add a handler for a G or M code that has no built-in case.
+   * The table is kept sorted by key for a binary search on dispatch.
+   * Return false if the table is full or the code is already registered.
+   */
+  bool GcodeSuite::register_handler(const char letter, const uint16_t codenum, const handler_t handler) {
+    if ((letter != 'G' && letter != 'M') || codenum > 0x7FFF || registry_count >= GCODE_REGISTRY_SIZE) return false;
+    const uint16_t key = registry_key(letter, codenum);
+    uint8_t i = registry_count;
+    for (; i && registry[i - 1].key >= key; --i)
+      if (registry[i - 1].key == key) return false;
+    for (uint8_t j = registry_count; j > i; --j) registry[j] = registry[j - 1];
+    registry[i] = { key, handler };
+    registry_count++;
+    return true;
+  }
+
+  /**
+   * Run the registered handler for the current command, if there is one
+   */
+  bool GcodeSuite::run_registered_handler() {
+    const uint16_t key = registry_key(parser.command_letter, parser.codenum);
+    uint8_t lo = 0, hi = registry_count;
+    while (lo < hi) {
+      const uint8_t mid = (lo + hi) >> 1;
+      const uint16_t k = registry[mid].key;
+      if (k == key) { registry[mid].handler(); return true; }
+      if (k < key) lo = mid + 1; else hi = mid;
+    }
+    return false;
+  }
+
+#endif
+
 /**
  * Get the target extruder from the T parameter or the active_extruder
  * Return -1 if the T parameter is out of range
@@ -245,6 +298,14 @@ void GcodeSuite::dwell(millis_t time) {
 void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
   KEEPALIVE_STATE(IN_HANDLER);
 
+  #if ENABLED(GCODE_PROFILER)
+    // Subcommands run by the handler change the parser state, so save the key now
+    const char profile_letter = parser.command_letter;
+    const uint16_t profile_codenum = parser.codenum;
+    const uint8_t profile_subcode = TERN0(USE_GCODE_SUBCODES, parser.subcode);
+    const uint32_t profile_start = micros();
+  #endif
+
  /**
   * Block all Gcodes except M511 Unlock Printer, if printer is locked
   * Will still block Gcodes if M511 is disabled, in which case the printer should be unlocked via LCD Menu
@@ -383,7 +444,12 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 800: parser.debug(); break;                          // G800: GCode Parser Test for G
       #endif
 
-      default: parser.unknown_command_warning(); break;
+      default:
+        #if ENABLED(GCODE_HANDLER_REGISTRY)
+          if (run_registered_handler()) break;
+        #endif
+        parser.unknown_command_warning();
+        break;
     }
     break;
 
@@ -676,6 +742,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 305: M305(); break;                                  // M305: Set user thermistor parameters
       #endif
 
+      #if ENABLED(MPCTEMP)
+        case 306: M306(); break;                                  // M306: Set or tune the hotend model
+      #endif
+
       #if ENABLED(REPETIER_GCODE_M360)
         case 360: M360(); break;                                  // M360: Firmware settings
       #endif
@@ -771,6 +841,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(INPUT_SHAPING)
+        case 593: M593(); break;                                  // M593: Set input shaping
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
@@ -887,6 +961,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 869: M869(); break;                                  // M869: Report axis error
       #endif
 
+      #ifdef ARC_CHORD_TOLERANCE
+        case 930: M930(); break;                                  // M930: Set arc chord tolerance
+      #endif
+
       #if ENABLED(MAGNETIC_PARKING_EXTRUDER)
         case 951: M951(); break;                                  // M951: Set Magnetic Parking Extruder parameters
       #endif
@@ -895,6 +973,18 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 422: M422(); break;                                  // M422: Set Z Stepper automatic alignment position using probe
       #endif
 
+      #if ENABLED(MOTION_BENCHMARK)
+        case 990: M990(); break;                                  // M990: Motion benchmark report
+      #endif
+
+      #if ENABLED(GCODE_PROFILER)
+        case 991: M991(); break;                                  // M991: G-code profile report
+      #endif
+
+      #if ENABLED(EVENT_TRACE)
+        case 992: M992(); break;                                  // M992: Send the event trace
+      #endif
+
       #if ALL(HAS_SPI_FLASH, SDSUPPORT, MARLIN_DEV_MODE)
         case 993: M993(); break;                                  // M993: Backup SPI Flash to SD
         case 994: M994(); break;                                  // M994: Load a Backup from SD to SPI Flash
@@ -904,6 +994,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 995: M995(); break;                                  // M995: Touch screen calibration for TFT display
       #endif
 
+      #if ENABLED(TFT_DIRTY_REGIONS)
+        case 996: M996(); break;                                  // M996: TFT pixels per frame report
+      #endif
+
       #if ENABLED(PLATFORM_M997_SUPPORT)
         case 997: M997(); break;                                  // M997: Perform in-application firmware update
       #endif
@@ -923,7 +1017,12 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 7219: M7219(); break;                                // M7219: Set LEDs, columns, and rows
       #endif
 
-      default: parser.unknown_command_warning(); break;
+      default:
+        #if ENABLED(GCODE_HANDLER_REGISTRY)
+          if (run_registered_handler()) break;
+        #endif
+        parser.unknown_command_warning();
+        break;
     }
     break;
 
@@ -940,6 +1039,8 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
       parser.unknown_command_warning();
   }
 
+  TERN_(GCODE_PROFILER, gcode_profiler.add(profile_letter, profile_codenum, profile_subcode, micros() - profile_start));
+
   if (!no_ok) queue.ok_to_send();
 }
 
@@ -948,7 +1049,7 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
  * This is called from the main loop()
  */
 void GcodeSuite::process_next_command() {
-  char * const current_command = queue.command_buffer[queue.index_r];
+  char * const current_command = queue.command(queue.index_r);
 
   PORT_REDIRECT(queue.port[queue.index_r]);
 
@@ -958,10 +1059,15 @@ void GcodeSuite::process_next_command() {
 
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
-    SERIAL_ECHOLN(current_command);
+    #if ENABLED(BINARY_GCODE)
+      if (BinaryGcode::is_frame(current_command))
+        BinaryGcode::print(current_command);
+      else
+    #endif
+        SERIAL_ECHOLN(current_command);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPAIR("slot:", queue.index_r);
-      M100_dump_routine(PSTR("   Command Queue:"), &queue.command_buffer[0][0], &queue.command_buffer[BUFSIZE - 1][MAX_CMD_SIZE - 1]);
+      M100_dump_routine(PSTR("   Command Queue:"), &queue.command_buffer[0][0], &queue.command_buffer[COMMAND_BUFFERS - 1][MAX_CMD_SIZE - 1]);
     #endif
   }
 
@@ -197,6 +197,7 @@
  * M303 - PID relay autotune S<temperature> sets the target temperature. Default 150C. (Requires PIDTEMP)
  * M304 - Set bed PID parameters P I and D. (Requires PIDTEMPBED)
  * M305 - Set user thermistor parameters R T and P. (Requires TEMP_SENSOR_x 1000)
+ * M306 - Set hotend model constants E P C R A F H, or autotune the model with T. (Requires MPCTEMP)
  * M350 - Set microstepping mode. (Requires digital microstepping pins.)
  * M351 - Toggle MS1 MS2 pins directly. (Requires digital microstepping pins.)
  * M355 - Set Case Light on/off and set brightness. (Requires CASE_LIGHT_PIN)
@@ -231,6 +232,7 @@
  * M524 - Abort the current SD print job started with M24. (Requires SDSUPPORT)
  * M540 - Enable/disable SD card abort on endstop hit: "M540 S<state>". (Requires SD_ABORT_ON_ENDSTOP_HIT)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
+ * M593 - Get or set X/Y input shaping: "M593 [X] [Y] T<type> F<hz> D<zeta>". (Requires INPUT_SHAPING)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -280,9 +282,14 @@
  * ************ Custom codes - This can change to suit future G-code regulations
  * G425 - Calibrate using a conductive object. (Requires CALIBRATION_GCODE)
  * M928 - Start SD logging: "M928 filename.gco". Stop with M29. (Requires SDSUPPORT)
+ * M930 - Set or report the arc chord tolerance (S) and shortest segment time (T). (Requires ARC_CHORD_TOLERANCE)
+ * M990 - Report or reset (R) the motion benchmark. (Requires MOTION_BENCHMARK)
+ * M991 - Report or reset (R) the G-code profile. (Requires GCODE_PROFILER)
+ * M992 - Send, clear (R), stop (S0) or start (S1) the event trace. (Requires EVENT_TRACE)
  * M993 - Backup SPI Flash to SD
  * M994 - Load a Backup from SD to SPI Flash
  * M995 - Touch screen calibration for TFT display
+ * M996 - Report or reset (R) the TFT pixels sent per frame. (Requires TFT_DIRTY_REGIONS)
  * M997 - Perform in-application firmware update
  * M999 - Restart after being stopped by error
  * D... - Custom Development G-code. Add hooks to 'gcode_D.cpp' for developers to test features. (Requires MARLIN_DEV_MODE)
@@ -338,6 +345,12 @@ public:
     static WorkspacePlane workspace_plane;
   #endif
 
+  #ifdef ARC_CHORD_TOLERANCE
+    static float arc_chord_tolerance;   // (mm) 0 for fixed-length segments. Set with M930 S
+    static uint16_t arc_segment_time;   // (ms) Shortest segment at the arc's feedrate. Set with M930 T
+    static uint16_t arc_segments;       // Segments in the last arc, reported by M930
+  #endif
+
   #define MAX_COORDINATE_SYSTEMS 9
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     static int8_t active_coordinate_system;
@@ -370,6 +383,12 @@ public:
     process_subcommands_now_P(G28_STR);
   }
 
+  #if ENABLED(GCODE_HANDLER_REGISTRY)
+    // Add a G or M code from a feature module
+    typedef void (*handler_t)();
+    static bool register_handler(const char letter, const uint16_t codenum, const handler_t handler);
+  #endif
+
   #if EITHER(HAS_AUTO_REPORTING, HOST_KEEPALIVE_FEATURE)
     static bool autoreport_paused;
     static inline bool set_autoreport_paused(const bool p) {
@@ -409,6 +428,14 @@ public:
 
 private:
 
+  #if ENABLED(GCODE_HANDLER_REGISTRY)
+    typedef struct { uint16_t key; handler_t handler; } registry_entry_t;
+    static registry_entry_t registry[GCODE_REGISTRY_SIZE];
+    static uint8_t registry_count;
+    static inline uint16_t registry_key(const char letter, const uint16_t codenum) { return (letter == 'M' ? 0x8000 : 0) | codenum; }
+    static bool run_registered_handler();
+  #endif
+
   TERN_(MARLIN_DEV_MODE, static void D(const int16_t dcode));
 
   static void G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move=false));
@@ -703,6 +730,8 @@ private:
 
   TERN_(HAS_USER_THERMISTORS, static void M305());
 
+  TERN_(MPCTEMP, static void M306());
+
   #if HAS_MICROSTEPS
     static void M350();
     static void M351();
@@ -780,6 +809,8 @@ private:
 
   TERN_(BAUD_RATE_GCODE, static void M575());
 
+  TERN_(INPUT_SHAPING, static void M593());
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
@@ -861,10 +892,22 @@ private:
 
   TERN_(SDSUPPORT, static void M928());
 
+  #ifdef ARC_CHORD_TOLERANCE
+    static void M930();
+  #endif
+
   TERN_(MAGNETIC_PARKING_EXTRUDER, static void M951());
 
+  TERN_(MOTION_BENCHMARK, static void M990());
+
+  TERN_(GCODE_PROFILER, static void M991());
+
+  TERN_(EVENT_TRACE, static void M992());
+
   TERN_(TOUCH_SCREEN_CALIBRATION, static void M995());
 
+  TERN_(TFT_DIRTY_REGIONS, static void M996());
+
   #if BOTH(HAS_SPI_FLASH, SDSUPPORT)
     static void M993();
     static void M994();
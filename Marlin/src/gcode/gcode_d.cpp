@@ -30,6 +30,11 @@
   #include "../HAL/shared/eeprom_if.h"
   #include "../HAL/shared/Delay.h"
 
+  #ifdef ARC_CHORD_TOLERANCE
+    uint16_t arc_segment_count(const float radius, const float mm_of_travel, const float tolerance,
+      const feedRate_t fr_mm_s, const float min_time, const uint16_t min_segments);
+  #endif
+
   /**
    * Dn: G-code for development and testing
    *
@@ -184,7 +189,29 @@
         DELAY_US(10000000);
         ENABLE_ISRS();
         SERIAL_ECHOLN("FAILURE: Watchdog did not trigger board reset.");
-      }
+      } break;
+
+      #ifdef ARC_CHORD_TOLERANCE
+        case 102: { // D102 Check the segment counts that plan_arc uses with ARC_CHORD_TOLERANCE
+          static const struct { float radius, mm, tolerance, fr_mm_s, min_time; uint16_t min_segments, segments; } arcs[] = {
+            { 20,   RADIANS(360) * 20,   0.01f,   0, 0,      1, 100 },  // Full circle, 1.26mm chords
+            { 80,   RADIANS(360) * 80,   0.01f,   0, 0,      1, 199 },  // Full circle, 2.53mm chords
+            { 80,   RADIANS(90) * 80,    0.1f,    0, 0,      1,  16 },  // Quarter circle
+            { 0.5f, RADIANS(360) * 0.5f, 1,       0, 0,      1,   1 },  // Tolerance over the radius
+            { 20,   RADIANS(360) * 20,   0.01f, 500, 0.005f, 1,  51 },  // 2.5mm chords to last 5ms at 500mm/s
+            { 0.5f, RADIANS(360) * 0.5f, 1,       0, 0,     24,  24 }   // MIN_ARC_SEGMENTS
+          };
+          bool ok = true;
+          LOOP_L_N(i, COUNT(arcs)) {
+            const uint16_t segments = arc_segment_count(arcs[i].radius, arcs[i].mm, arcs[i].tolerance, arcs[i].fr_mm_s, arcs[i].min_time, arcs[i].min_segments);
+            if (segments != arcs[i].segments) {
+              ok = false;
+              SERIAL_ECHOLNPAIR("Arc ", int(i), ": ", segments, " segments, expected ", arcs[i].segments);
+            }
+          }
+          SERIAL_ECHOLN(ok ? "Arc segment counts OK" : "FAILURE: Arc segment counts");
+        } break;
+      #endif
     }
   }
 
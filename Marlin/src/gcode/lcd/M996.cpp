@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(TFT_DIRTY_REGIONS)
+
+#include "../gcode.h"
+#include "../../lcd/tft/tft.h"
+
+/**
+ * M996: Report the pixels sent to the TFT per frame, and those skipped as unchanged
+ *
+ *  R - Reset the totals instead of reporting
+ */
+void GcodeSuite::M996() {
+  if (parser.seen('R')) {
+    TFT_Queue::reset_stats();
+    return;
+  }
+
+  SERIAL_ECHOLNPAIR("TFT frames:", TFT_Queue::frames,
+    " Last frame pixels:", TFT_Queue::frame_pixels, " skipped:", TFT_Queue::frame_skipped,
+    " Average pixels:", TFT_Queue::frames ? TFT_Queue::total_pixels / TFT_Queue::frames : 0,
+    " skipped:", TFT_Queue::frames ? TFT_Queue::total_skipped / TFT_Queue::frames : 0
+  );
+}
+
+#endif // TFT_DIRTY_REGIONS
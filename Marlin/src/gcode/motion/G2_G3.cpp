@@ -40,6 +40,26 @@
   #define N_ARC_CORRECTION 1
 #endif
 
+#ifdef ARC_CHORD_TOLERANCE
+
+  /**
+   * Segments for an arc with ARC_CHORD_TOLERANCE. Each is the longest chord
+   * whose middle is within the tolerance of the arc, but no shorter than
+   * min_time at the feedrate. The count is rounded up so no chord is longer,
+   * and is at least min_segments. A tolerance of the radius or more allows
+   * the whole arc as a single chord.
+   */
+  uint16_t arc_segment_count(const float radius, const float mm_of_travel, const float tolerance,
+    const feedRate_t fr_mm_s, const float min_time, const uint16_t min_segments
+  ) {
+    float seg_length = tolerance < radius ? 2 * SQRT(tolerance * (2 * radius - tolerance)) : mm_of_travel;
+    NOLESS(seg_length, fr_mm_s * min_time);
+    const uint16_t segments = CEIL(mm_of_travel / seg_length);
+    return _MAX(segments, min_segments);
+  }
+
+#endif
+
 /**
  * Plan an arc in 2 dimensions
  *
@@ -48,6 +68,12 @@
  * Arcs should only be made relatively large (over 5mm), as larger arcs with
  * larger segments will tend to be more efficient. Your slicer should have
  * options for G2/G3 arc generation. In future these options may be GCode tunable.
+ *
+ * With ARC_CHORD_TOLERANCE the segment length comes from the radius instead,
+ * as the longest chord that stays within the tolerance of the arc. Segments
+ * are kept long enough to last ARC_SEGMENT_MIN_TIME at the feedrate (twice
+ * that while the planner is under half full) so tight, fast arcs don't drain
+ * the planner. Both can be set with M930.
  */
 void plan_arc(
   const xyze_pos_t &cart,   // Destination position
@@ -116,6 +142,18 @@ void plan_arc(
   // Divide total travel by nominal segment length
   uint16_t segments = FLOOR(mm_of_travel / seg_length);
   NOLESS(segments, min_segments);         // At least some segments
+
+  #ifdef ARC_CHORD_TOLERANCE
+    const float tolerance = gcode.arc_chord_tolerance;
+    if (tolerance > 0) {
+      // Chords within the tolerance, but not so short that the planner runs dry
+      float min_time = gcode.arc_segment_time * 0.001f;
+      if (planner.movesplanned() < (BLOCK_BUFFER_SIZE) / 2) min_time *= 2;
+      segments = arc_segment_count(radius, mm_of_travel, tolerance, scaled_fr_mm_s, min_time, min_segments);
+    }
+    gcode.arc_segments = segments;
+  #endif
+
   seg_length = mm_of_travel / segments;
 
   /**
@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#ifdef ARC_CHORD_TOLERANCE
+
+#include "../gcode.h"
+
+/**
+ * M930: Set or report adaptive arc segmentation
+ *
+ *   S<linear>  Chord tolerance. 0 for MM_PER_ARC_SEGMENT segments.
+ *   T<ms>      Shortest segment time at the arc's feedrate.
+ *
+ * With no parameters report the settings and the segments in the last arc.
+ */
+void GcodeSuite::M930() {
+  if (parser.seenval('S')) arc_chord_tolerance = _MAX(parser.value_linear_units(), 0);
+  if (parser.seenval('T')) arc_segment_time = parser.value_ushort();
+
+  if (!parser.seen("ST")) {
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR_F("  M930 S", arc_chord_tolerance, 3);
+    SERIAL_ECHOPAIR(" T", arc_segment_time);
+    SERIAL_ECHOLNPAIR(" ; Last arc: ", arc_segments, " segments");
+  }
+}
+
+#endif // ARC_CHORD_TOLERANCE
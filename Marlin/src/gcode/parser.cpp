@@ -32,6 +32,14 @@
   #include "queue.h"
 #endif
 
+#if ENABLED(MOTION_BENCHMARK)
+  #include "../feature/benchmark.h"
+#endif
+
+#if ENABLED(BINARY_GCODE)
+  #include "../feature/binary_gcode.h"
+#endif
+
 // Must be declared for allocation and to satisfy the linker
 // Zero values need no initialization.
 
@@ -62,6 +70,10 @@ int GCodeParser::codenum;
   #endif
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  bool GCodeParser::binary;
+#endif
+
 #if ENABLED(FASTER_GCODE_PARSER)
   // Optimized Parameters
   uint32_t GCodeParser::codebits;  // found bits
@@ -84,6 +96,7 @@ void GCodeParser::reset() {
   command_letter = '?';                 // No command letter
   codenum = 0;                          // No command code
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
+  TERN_(BINARY_GCODE, binary = false);  // Text command
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
@@ -114,6 +127,12 @@ void GCodeParser::reset() {
 // 58 bytes of SRAM are used to speed up seen/value
 void GCodeParser::parse(char *p) {
 
+  TERN_(MOTION_BENCHMARK, BENCHMARK_SCOPE(PARSE));
+
+  #if ENABLED(BINARY_GCODE)
+    if (BinaryGcode::is_frame(p)) return parse_binary(p);
+  #endif
+
   reset(); // No codes to report
 
   auto uppercase = [](char c) {
@@ -341,10 +360,95 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+/**
+ * Parse the [-+]ddd.ddd numbers that make up nearly all G-code parameters
+ * without calling strtof, which is slow on 8-bit and small 32-bit MCUs.
+ * The digits are collected in an integer and divided once by a power of 10.
+ * Both are exact in a float up to 2^24, so the result is rounded just as
+ * strtof would round it. Anything else (longer numbers, hex, inf, nan,
+ * leading spaces) goes to strtof. As before, an 'E' ends the number.
+ */
+float GCodeParser::parse_float(char * const p) {
+  static const float decimal_scale[] PROGMEM = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f };
+
+  TERN_(MOTION_BENCHMARK, motion_benchmark.sample_float(p));
+
+  const char *c = p;
+  const bool neg = (*c == '-');
+  if (neg || *c == '+') c++;
+
+  uint32_t m = 0;
+  uint8_t digits = 0, frac = 0;
+  bool point = false;
+  for (;; c++) {
+    if (NUMERIC(*c)) {
+      if (++digits > 9) return strtof_no_exp(p);
+      m = m * 10 + (*c - '0');
+      frac += point;
+    }
+    else if (*c == '.' && !point)
+      point = true;
+    else
+      break;
+  }
+  if (!digits || m > 0x1000000UL || *c == 'x' || *c == 'X') return strtof_no_exp(p);
+
+  float f = m;
+  if (frac) f /= pgm_read_float(&decimal_scale[frac]);
+  return neg ? -f : f;
+}
+
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * Set the command and parameter table from a frame already checked by
+   * BinaryGcode::validate. Parameter offsets point at the float values in
+   * the frame, so value_float() is a plain copy.
+   */
+  void GCodeParser::parse_binary(char * const p) {
+    reset();
+    binary = true;
+    command_ptr = p;
+    command_letter = BinaryGcode::letter(p);
+    codenum = BinaryGcode::codenum(p);
+
+    const uint8_t f = BinaryGcode::flags(p);
+    uint8_t i = BG_HEADER_LEN + BG_PARAMS_LEN;
+    if (f & BG_FLAG_LINE) i += 4;
+    if (f & BG_FLAG_SUB) {
+      TERN_(USE_GCODE_SUBCODES, subcode = p[i]);
+      i++;
+    }
+    uint32_t bare = 0;
+    if (f & BG_FLAG_BARE) { bare = BinaryGcode::get_u32(&p[i]); i += 4; }
+
+    codebits = BinaryGcode::params(p);
+    LOOP_L_N(b, COUNT(param)) if (TEST32(codebits, b)) {
+      if (TEST32(bare, b))
+        param[b] = 0;
+      else {
+        param[b] = i;
+        i += sizeof(float);
+      }
+    }
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G'
+        && (codenum <= TERN(ARC_SUPPORT, 3, 1) || codenum == 5 || TERN0(G38_PROBE_TARGET, codenum == 38))
+      ) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+  }
+
+#endif // BINARY_GCODE
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
   bool GCodeParser::chain() {
+    if (TERN0(BINARY_GCODE, binary)) return false;
     #if ENABLED(FASTER_GCODE_PARSER)
       char *next_command = command_ptr;
       if (next_command) {
@@ -362,6 +466,16 @@ void GCodeParser::parse(char *p) {
 #endif // CNC_COORDINATE_SYSTEMS
 
 void GCodeParser::unknown_command_warning() {
+  #if ENABLED(BINARY_GCODE)
+    if (binary) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPGM(STR_UNKNOWN_COMMAND);
+      SERIAL_CHAR(command_letter);
+      SERIAL_ECHO(codenum);
+      SERIAL_ECHOLNPGM("\"");
+      return;
+    }
+  #endif
   SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, command_ptr, "\"");
 }
 
@@ -97,6 +97,10 @@ public:
     FORCE_INLINE static void cancel_motion_mode() { motion_mode_codenum = -1; }
   #endif
 
+  #if ENABLED(BINARY_GCODE)
+    static bool binary;                   // The command is a binary frame
+  #endif
+
   #if ENABLED(DEBUG_GCODE_PARSER)
     static void debug();
   #endif
@@ -149,7 +153,7 @@ public:
       if (b) {
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
-          value_ptr = valid_number(ptr) ? ptr : nullptr;
+          value_ptr = (TERN0(BINARY_GCODE, binary) || valid_number(ptr)) ? ptr : nullptr;
         }
         else
           value_ptr = nullptr;
@@ -239,6 +243,11 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if ENABLED(BINARY_GCODE)
+    // Populate all fields from a validated binary frame
+    static void parse_binary(char * const p);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -251,31 +260,48 @@ public:
   static inline bool seenval(const char c) { return seen(c) && has_value(); }
 
   // The value as a string
-  static inline char* value_string() { return value_ptr; }
+  static inline char* value_string() { return TERN0(BINARY_GCODE, binary) ? nullptr : value_ptr; }
 
   // Float removes 'E' to prevent scientific notation interpretation
-  static inline float value_float() {
-    if (value_ptr) {
-      char *e = value_ptr;
-      for (;;) {
-        const char c = *e;
-        if (c == '\0' || c == ' ') break;
-        if (c == 'E' || c == 'e') {
-          *e = '\0';
-          const float ret = strtof(value_ptr, nullptr);
-          *e = c;
-          return ret;
-        }
-        ++e;
+  static inline float strtof_no_exp(char * const p) {
+    char *e = p;
+    for (;;) {
+      const char c = *e;
+      if (c == '\0' || c == ' ') break;
+      if (c == 'E' || c == 'e') {
+        *e = '\0';
+        const float ret = strtof(p, nullptr);
+        *e = c;
+        return ret;
       }
-      return strtof(value_ptr, nullptr);
+      ++e;
     }
-    return 0;
+    return strtof(p, nullptr);
+  }
+
+  // Parse a plain decimal number with integer math, falling back to strtof_no_exp
+  static float parse_float(char * const p);
+
+  static inline float value_float() {
+    #if ENABLED(BINARY_GCODE)
+      if (binary) {
+        float f = 0;
+        if (value_ptr) memcpy(&f, value_ptr, sizeof(f));
+        return f;
+      }
+    #endif
+    return value_ptr ? parse_float(value_ptr) : 0;
   }
 
   // Code value as a long or ulong
-  static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  static inline int32_t value_long() {
+    if (TERN0(BINARY_GCODE, binary)) return LROUND(value_float());
+    return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L;
+  }
+  static inline uint32_t value_ulong() {
+    if (TERN0(BINARY_GCODE, binary)) return uint32_t(LROUND(value_float()));
+    return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL;
+  }
 
   // Code value for use as time
   static inline millis_t value_millis() { return value_ulong(); }
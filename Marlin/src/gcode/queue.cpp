@@ -43,10 +43,18 @@ GCodeQueue queue;
   #include "../feature/binary_stream.h"
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  #include "../feature/binary_gcode.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
 
+#if ENABLED(EVENT_TRACE)
+  #include "../feature/event_trace.h"
+#endif
+
 /**
  * GCode line number handling. Hosts may opt to include line numbers when
  * sending commands to Marlin, and lines will be checked for sequentiality.
@@ -56,9 +64,9 @@ long GCodeQueue::last_N[NUM_SERIAL];
 
 /**
  * GCode Command Queue
- * A simple ring buffer of BUFSIZE command strings.
+ * A ring buffer of BUFSIZE commands, each one the index of a command buffer.
  *
- * Commands are copied into this buffer by the command injectors
+ * Commands are written into a free buffer by the command injectors
  * (immediate, serial, sd card) and they are processed sequentially by
  * the main loop. The gcode.process_next_command method parses the next
  * command and hands off execution to individual handler functions.
@@ -67,7 +75,18 @@ uint8_t GCodeQueue::length = 0,  // Count of commands in the queue
         GCodeQueue::index_r = 0, // Ring buffer read position
         GCodeQueue::index_w = 0; // Ring buffer write position
 
-char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
+char GCodeQueue::command_buffer[COMMAND_BUFFERS][MAX_CMD_SIZE];
+uint8_t GCodeQueue::command_slot[BUFSIZE];
+
+/**
+ * Command buffers not in the queue. Each serial port holds one more buffer
+ * for the line it is receiving. The SD card and the other injectors write
+ * into the top of the free stack, which is never empty while there's room
+ * in the queue.
+ */
+uint8_t GCodeQueue::free_slot[COMMAND_BUFFERS],
+        GCodeQueue::free_count,
+        GCodeQueue::rx_slot[NUM_SERIAL];
 
 /*
  * The port that the command was received on
@@ -99,6 +118,10 @@ char GCodeQueue::injected_commands[64]; // = { 0 }
 GCodeQueue::GCodeQueue() {
   // Send "ok" after commands by default
   LOOP_L_N(i, COUNT(send_ok)) send_ok[i] = true;
+
+  // Give each serial port a buffer of its own and free the rest
+  LOOP_L_N(i, NUM_SERIAL) rx_slot[i] = BUFSIZE + i;
+  clear();
 }
 
 /**
@@ -113,21 +136,31 @@ bool GCodeQueue::has_commands_queued() {
  */
 void GCodeQueue::clear() {
   index_r = index_w = length = 0;
+
+  // Free every buffer except the serial receive buffers, which may hold partial lines
+  free_count = 0;
+  LOOP_L_N(s, COMMAND_BUFFERS) {
+    bool rx = false;
+    LOOP_L_N(i, NUM_SERIAL) if (rx_slot[i] == s) rx = true;
+    if (!rx) free_slot[free_count++] = s;
+  }
 }
 
 /**
- * Once a new command is in the ring buffer, call this to commit it
+ * Once a new command is in the next_slot() buffer, call this to commit it
  */
 void GCodeQueue::_commit_command(bool say_ok
   #if HAS_MULTI_SERIAL
     , int16_t p/*=-1*/
   #endif
 ) {
+  command_slot[index_w] = free_slot[--free_count];
   send_ok[index_w] = say_ok;
   TERN_(HAS_MULTI_SERIAL, port[index_w] = p);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
   if (++index_w >= BUFSIZE) index_w = 0;
   length++;
+  TERN_(EVENT_TRACE, event_trace.record(TRACE_COMMAND_QUEUE, length));
 }
 
 /**
@@ -141,7 +174,7 @@ bool GCodeQueue::_enqueue(const char* cmd, bool say_ok/*=false*/
   #endif
 ) {
   if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(command_buffer[index_w], cmd);
+  strcpy(command_buffer[next_slot()], cmd);
   _commit_command(say_ok
     #if HAS_MULTI_SERIAL
       , pn
@@ -282,13 +315,17 @@ void GCodeQueue::ok_to_send() {
   if (!send_ok[index_r]) return;
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
-    char* p = command_buffer[index_r];
+    char* p = command(index_r);
     if (*p == 'N') {
       SERIAL_ECHO(' ');
       SERIAL_ECHO(*p++);
       while (NUMERIC_SIGNED(*p))
         SERIAL_ECHO(*p++);
     }
+    #if ENABLED(BINARY_GCODE)
+      long n;
+      if (BinaryGcode::is_frame(p) && BinaryGcode::line_number(p, n)) SERIAL_ECHOPAIR(" N", n);
+    #endif
     SERIAL_ECHOPAIR_P(SP_P_STR, int(planner.moves_free()),
                       SP_B_STR, int(BUFSIZE - length));
   #endif
@@ -336,6 +373,10 @@ void GCodeQueue::gcode_line_error(PGM_P const err, const int8_t pn) {
 }
 
 FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", but not "M290", etc
+  #if ENABLED(BINARY_GCODE)
+    if (BinaryGcode::is_frame(cmd))
+      return BinaryGcode::letter(cmd) == 'M' && BinaryGcode::codenum(cmd) == 29 && !(BinaryGcode::flags(cmd) & BG_FLAG_SUB);
+  #endif
   const char * const m29 = strstr_P(cmd, PSTR("M29"));
   return m29 && !NUMERIC(m29[3]);
 }
@@ -345,6 +386,7 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_QUOTED 2
 #define PS_PAREN  3
 #define PS_ESC    4
+#define PS_BINARY 8   // Receiving a binary frame (above PS_ESC + PS_PAREN)
 
 inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
 
@@ -410,24 +452,80 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return true;
 }
 
+/**
+ * Queue the line received on a serial port where it is, then
+ * give the port a free buffer for its next line. The line is
+ * dropped if the queue is already full.
+ */
+void GCodeQueue::_commit_serial_line(const uint8_t pn) {
+  if (length >= BUFSIZE) return;
+  uint8_t &top = free_slot[free_count - 1];
+  const uint8_t s = rx_slot[pn];
+  rx_slot[pn] = top;
+  top = s;
+  _commit_command(true
+    #if HAS_MULTI_SERIAL
+      , pn
+    #endif
+  );
+}
+
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * Check the line number of a binary frame received on a serial port and
+   * add the frame to the queue where it is. Return false after a line error.
+   */
+  bool GCodeQueue::_enqueue_frame(const uint8_t pn) {
+    const char * const frame = command_buffer[rx_slot[pn]];
+    const char letter = BinaryGcode::letter(frame);
+    const uint16_t code = BinaryGcode::codenum(frame);
+
+    long gcode_N;
+    if (BinaryGcode::line_number(frame, gcode_N)) {
+      if (gcode_N != last_N[pn] + 1 && !(letter == 'M' && code == 110)) {
+        gcode_line_error(PSTR(STR_ERR_LINE_NO), pn);
+        return false;
+      }
+      last_N[pn] = gcode_N;
+    }
+    #if ENABLED(SDSUPPORT)
+      // Frames saved by M28 need a line number, like text lines
+      else if (card.flag.saving && !is_M29(frame)) {
+        gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), pn);
+        return false;
+      }
+    #endif
+
+    // Movement commands give an alert when the machine is stopped
+    if (IsStopped() && letter == 'G' && (code <= TERN(ARC_SUPPORT, 3, 1) || TERN0(BEZIER_CURVE_SUPPORT, code == 5))) {
+      PORT_REDIRECT(pn);
+      SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+      LCD_MESSAGEPGM(MSG_STOPPED);
+    }
+
+    _commit_serial_line(pn);
+    return true;
+  }
+
+#endif // BINARY_GCODE
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
  * left on the serial port.
  */
 void GCodeQueue::get_serial_commands() {
-  static char serial_line_buffer[NUM_SERIAL][MAX_CMD_SIZE];
-
   static uint8_t serial_input_state[NUM_SERIAL] = { PS_NORMAL };
 
   #if ENABLED(BINARY_FILE_TRANSFER)
     if (card.flag.binary_mode) {
       /**
-       * For binary stream file transfer, use serial_line_buffer as the working
+       * For binary stream file transfer, use the port's line buffer as the working
        * receive buffer (which limits the packet size to MAX_CMD_SIZE).
        * The receive buffer also limits the packet size for reliable transmission.
        */
-      binaryStream[card.transfer_port_index].receive(serial_line_buffer[card.transfer_port_index]);
+      binaryStream[card.transfer_port_index].receive(command_buffer[rx_slot[card.transfer_port_index]]);
       return;
     }
   #endif
@@ -453,14 +551,34 @@ void GCodeQueue::get_serial_commands() {
       if (c < 0) continue;
 
       const char serial_char = c;
+      char (&line)[MAX_CMD_SIZE] = command_buffer[rx_slot[i]];
+
+      #if ENABLED(BINARY_GCODE)
+        // A frame start where a line would begin is followed by a whole binary frame
+        if (serial_input_state[i] == PS_BINARY
+          || (c == BG_START && serial_count[i] == 0 && serial_input_state[i] == PS_NORMAL)
+        ) {
+          serial_input_state[i] = PS_BINARY;
+          const BinaryGcode::Result r = BinaryGcode::receive(line, serial_count[i], c);
+          if (r == BinaryGcode::BG_PENDING) continue;
+          serial_input_state[i] = PS_NORMAL;
+          serial_count[i] = 0;
+          if (r != BinaryGcode::BG_OK) return gcode_line_error(PSTR(STR_ERR_BINARY_FRAME), i);
+          if (!_enqueue_frame(i)) return;
+          #if defined(NO_TIMEOUTS) && NO_TIMEOUTS > 0
+            last_command_time = ms;
+          #endif
+          continue;
+        }
+      #endif
 
       if (ISEOL(serial_char)) {
 
         // Reset our state, continue if the line was empty
-        if (process_line_done(serial_input_state[i], serial_line_buffer[i], serial_count[i]))
+        if (process_line_done(serial_input_state[i], line, serial_count[i]))
           continue;
 
-        char* command = serial_line_buffer[i];
+        char* command = line;
 
         while (*command == ' ') command++;                   // Skip leading spaces
         char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
@@ -534,15 +652,11 @@ void GCodeQueue::get_serial_commands() {
           last_command_time = ms;
         #endif
 
-        // Add the command to the queue
-        _enqueue(serial_line_buffer[i], true
-          #if HAS_MULTI_SERIAL
-            , i
-          #endif
-        );
+        // Add the line to the queue without copying it
+        _commit_serial_line(i);
       }
       else
-        process_stream_char(serial_char, serial_input_state[i], serial_line_buffer[i], serial_count[i]);
+        process_stream_char(serial_char, serial_input_state[i], line, serial_count[i]);
 
     } // for NUM_SERIAL
   } // queue has space, serial has data
@@ -568,13 +682,42 @@ void GCodeQueue::get_serial_commands() {
       card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
 
+      #if ENABLED(BINARY_GCODE)
+        // A binary frame is read straight into the queue
+        if (n == BG_START && sd_count == 0 && sd_input_state == PS_NORMAL) {
+          char * const frame = command_buffer[next_slot()];
+          BinaryGcode::Result r = BinaryGcode::receive(frame, sd_count, n);
+          while (r == BinaryGcode::BG_PENDING && !card_eof) {
+            const int16_t b = card.get();
+            card_eof = card.eof();
+            if (b < 0) {
+              if (!card_eof) SERIAL_ERROR_MSG(STR_SD_ERR_READ);
+              continue;
+            }
+            r = BinaryGcode::receive(frame, sd_count, b);
+          }
+          if (r == BinaryGcode::BG_OK) {
+            _commit_command(false);
+            TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex()); // Prime for the NEXT _commit_command
+          }
+          else {
+            SERIAL_ERROR_MSG(STR_SD_ERR_BINARY_FRAME);
+            // With no valid LEN the frame has no known end, so skip to the next line
+            if (sd_count <= BG_HEADER_LEN) sd_input_state = PS_EOL;
+          }
+          sd_count = 0;
+          if (card_eof) card.fileHasFinished();
+          continue;
+        }
+      #endif
+
       const char sd_char = (char)n;
       const bool is_eol = ISEOL(sd_char);
       if (is_eol || card_eof) {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
+        if (!process_line_done(sd_input_state, command_buffer[next_slot()], sd_count)) {
           _commit_command(false);
           #if ENABLED(POWER_LOSS_RECOVERY)
             recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
@@ -584,7 +727,7 @@ void GCodeQueue::get_serial_commands() {
         if (card_eof) card.fileHasFinished();         // Handle end of file reached
       }
       else
-        process_stream_char(sd_char, sd_input_state, command_buffer[index_w], sd_count);
+        process_stream_char(sd_char, sd_input_state, command_buffer[next_slot()], sd_count);
 
     }
   }
@@ -618,8 +761,8 @@ void GCodeQueue::advance() {
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
-      char* command = command_buffer[index_r];
-      if (is_M29(command)) {
+      char * const cmd = command(index_r);
+      if (is_M29(cmd)) {
         // M29 closes the file
         card.closefile();
         SERIAL_ECHOLNPGM(STR_FILE_SAVED);
@@ -637,7 +780,7 @@ void GCodeQueue::advance() {
       }
       else {
         // Write the string from the read buffer to SD
-        card.write_command(command);
+        card.write_command(cmd);
         if (card.flag.logging)
           gcode.process_next_command(); // The card is saving because it's logging
         else
@@ -654,7 +797,10 @@ void GCodeQueue::advance() {
   #endif // SDSUPPORT
 
   // The queue may be reset by a command handler or by code invoked by idle() within a handler
+  if (!length) return;
+  free_slot[free_count++] = command_slot[index_r];
   --length;
   if (++index_r >= BUFSIZE) index_r = 0;
+  TERN_(EVENT_TRACE, event_trace.record(TRACE_COMMAND_QUEUE, length));
 
 }
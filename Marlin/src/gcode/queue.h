@@ -28,6 +28,9 @@
 
 #include "../inc/MarlinConfig.h"
 
+// One buffer per queued command plus one for the line each serial port is receiving
+#define COMMAND_BUFFERS (BUFSIZE + NUM_SERIAL)
+
 class GCodeQueue {
 public:
   /**
@@ -40,17 +43,23 @@ public:
 
   /**
    * GCode Command Queue
-   * A simple ring buffer of BUFSIZE command strings.
+   * A ring buffer of BUFSIZE commands, each one the index of a command buffer.
    *
-   * Commands are copied into this buffer by the command injectors
+   * Commands are written into a free buffer by the command injectors
    * (immediate, serial, sd card) and they are processed sequentially by
-   * the main loop. The gcode.process_next_command method parses the next
-   * command and hands off execution to individual handler functions.
+   * the main loop. Serial lines are received directly into a buffer that is
+   * queued as-is when the line is complete, so they are never copied.
+   * The gcode.process_next_command method parses the next command in place
+   * and hands off execution to individual handler functions.
    */
   static uint8_t length,  // Count of commands in the queue
                  index_r; // Ring buffer read position
 
-  static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
+  static char command_buffer[COMMAND_BUFFERS][MAX_CMD_SIZE];
+  static uint8_t command_slot[BUFSIZE];   // The command buffer for each queue position
+
+  // The command at a queue position
+  static inline char* command(const uint8_t index) { return command_buffer[command_slot[index]]; }
 
   /**
    * The port that the command was received on
@@ -151,6 +160,13 @@ private:
 
   static uint8_t index_w;  // Ring buffer write position
 
+  static uint8_t free_slot[COMMAND_BUFFERS],  // Stack of unused command buffers
+                 free_count,
+                 rx_slot[NUM_SERIAL];         // The buffer receiving each serial port's next line
+
+  // The buffer that the next _commit_command will queue
+  static inline uint8_t next_slot() { return free_slot[free_count - 1]; }
+
   static void get_serial_commands();
 
   #if ENABLED(SDSUPPORT)
@@ -169,6 +185,12 @@ private:
     #endif
   );
 
+  static void _commit_serial_line(const uint8_t pn);
+
+  #if ENABLED(BINARY_GCODE)
+    static bool _enqueue_frame(const uint8_t pn);
+  #endif
+
   // Process the next "immediate" command (PROGMEM)
   static bool process_injected_command_P();
 
@@ -335,6 +335,11 @@
   #define HAS_TFT_XPT2046 1
 #endif
 
+// Color UI regions to remember for TFT_DIRTY_REGIONS
+#if ENABLED(TFT_DIRTY_REGIONS) && !defined(TFT_DIRTY_REGION_COUNT)
+  #define TFT_DIRTY_REGION_COUNT 24
+#endif
+
 // Touch Screen or "Touch Buttons" need XPT2046 pins
 // but they use different components
 #if EITHER(HAS_TFT_XPT2046, HAS_TOUCH_XPT2046)
@@ -594,6 +594,24 @@
   #error "SERIAL_XON_XOFF and SERIAL_STATS_* features not supported on USB-native AVR devices."
 #endif
 
+#ifdef SERIAL_DROP_AUTO_REPORTS
+  #if IS_AT90USB
+    #error "SERIAL_DROP_AUTO_REPORTS is not supported on USB-native AVR devices."
+  #elif !(defined(__AVR__) || defined(ARDUINO_ARCH_SAM) || defined(ARDUINO_ARCH_STM32) || defined(__PLAT_LINUX__))
+    #error "SERIAL_DROP_AUTO_REPORTS requires the AVR, DUE, STM32, or LINUX HAL."
+  #elif NONE(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS)
+    #error "SERIAL_DROP_AUTO_REPORTS requires AUTO_REPORT_TEMPERATURES or AUTO_REPORT_SD_STATUS."
+  #elif !WITHIN(SERIAL_DROP_AUTO_REPORTS, 1, 255)
+    #error "SERIAL_DROP_AUTO_REPORTS must be from 1 to 255."
+  #elif defined(__AVR__) && SERIAL_DROP_AUTO_REPORTS >= TX_BUFFER_SIZE
+    #error "SERIAL_DROP_AUTO_REPORTS must be less than TX_BUFFER_SIZE."
+  #endif
+#endif
+
+#if ENABLED(SERIAL_STATS_TX_BLOCKED) && (!defined(__AVR__) || IS_AT90USB || !TX_BUFFER_SIZE)
+  #error "SERIAL_STATS_TX_BLOCKED requires an AVR hardware serial port with a TX_BUFFER_SIZE."
+#endif
+
 #ifndef SERIAL_PORT
   #error "SERIAL_PORT must be defined in Configuration.h"
 #elif defined(SERIAL_PORT_2) && SERIAL_PORT_2 == SERIAL_PORT
@@ -3196,5 +3214,197 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #endif
 #endif
 
+/**
+ * Sanity check for Motion Benchmark
+ */
+#if ENABLED(MOTION_BENCHMARK) && !defined(__PLAT_LINUX__)
+  #error "MOTION_BENCHMARK requires the linux_native environment."
+#endif
+
+/**
+ * Sanity check for SD read-ahead
+ */
+#if ENABLED(SD_READ_AHEAD)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_READ_AHEAD requires SDSUPPORT."
+  #elif EITHER(SDIO_SUPPORT, USB_FLASH_DRIVE_SUPPORT)
+    #error "SD_READ_AHEAD requires an SPI SD card. Disable SDIO_SUPPORT and USB_FLASH_DRIVE_SUPPORT."
+  #elif !WITHIN(SD_READ_AHEAD_BLOCKS, 2, 16)
+    #error "SD_READ_AHEAD_BLOCKS must be from 2 to 16."
+  #endif
+#endif
+
+/**
+ * Sanity check for Input Shaping
+ */
+#if ENABLED(INPUT_SHAPING)
+  #if IS_KINEMATIC
+    #error "INPUT_SHAPING is not compatible with DELTA or SCARA."
+  #elif defined(__AVR__)
+    #error "INPUT_SHAPING requires a 32-bit board."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "INPUT_SHAPING is not compatible with I2S_STEPPER_STREAM."
+  #elif HAS_L64XX
+    #error "INPUT_SHAPING is not compatible with L64XX stepper drivers."
+  #elif ENABLED(BABYSTEP_XY)
+    #error "INPUT_SHAPING is not compatible with BABYSTEP_XY."
+  #elif !WITHIN(SHAPING_TYPE_X, 0, 4) || !WITHIN(SHAPING_TYPE_Y, 0, 4)
+    #error "SHAPING_TYPE_[XY] must be from 0 to 4."
+  #elif defined(SHAPING_BUFFER_SIZE) && !WITHIN(SHAPING_BUFFER_SIZE, 16, 4096)
+    #error "SHAPING_BUFFER_SIZE must be from 16 to 4096."
+  #endif
+  static_assert(SHAPING_FREQ_X > 0 && SHAPING_FREQ_Y > 0, "SHAPING_FREQ_[XY] must be greater than 0.");
+  static_assert(WITHIN(SHAPING_ZETA_X, 0, 0.99) && WITHIN(SHAPING_ZETA_Y, 0, 0.99), "SHAPING_ZETA_[XY] must be from 0 to 0.99.");
+#endif
+
+/**
+ * Sanity check for Binary G-code
+ */
+#if ENABLED(BINARY_GCODE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "BINARY_GCODE requires FASTER_GCODE_PARSER."
+  #elif MAX_CMD_SIZE < 64
+    #error "BINARY_GCODE requires MAX_CMD_SIZE of 64 or more."
+  #endif
+#endif
+
+/**
+ * Sanity check for G-code Profiler and handler registry
+ */
+#if ENABLED(GCODE_PROFILER) && !WITHIN(GCODE_PROFILER_SLOTS, 1, 255)
+  #error "GCODE_PROFILER_SLOTS must be from 1 to 255."
+#endif
+#if ENABLED(GCODE_HANDLER_REGISTRY) && !WITHIN(GCODE_REGISTRY_SIZE, 1, 255)
+  #error "GCODE_REGISTRY_SIZE must be from 1 to 255."
+#endif
+
+/**
+ * Sanity check for Event Trace
+ */
+#if ENABLED(EVENT_TRACE) && !WITHIN(EVENT_TRACE_SIZE, 16, 8192)
+  #error "EVENT_TRACE_SIZE must be from 16 to 8192."
+#endif
+
+/**
+ * Sanity check for UBL Cell Cache
+ */
+#if ENABLED(UBL_CELL_CACHE) && DISABLED(AUTO_BED_LEVELING_UBL)
+  #error "UBL_CELL_CACHE requires AUTO_BED_LEVELING_UBL."
+#endif
+
+/**
+ * Sanity check for Delta Adaptive Segmentation
+ */
+#ifdef DELTA_SEGMENT_TOLERANCE
+  #if DISABLED(DELTA)
+    #error "DELTA_SEGMENT_TOLERANCE requires DELTA."
+  #endif
+  static_assert(DELTA_SEGMENT_TOLERANCE > 0, "DELTA_SEGMENT_TOLERANCE must be greater than 0.");
+#endif
+
+/**
+ * Sanity check for Adaptive Arc Segmentation
+ */
+#ifdef ARC_CHORD_TOLERANCE
+  #if DISABLED(ARC_SUPPORT)
+    #error "ARC_CHORD_TOLERANCE requires ARC_SUPPORT."
+  #elif !defined(ARC_SEGMENT_MIN_TIME)
+    #error "ARC_CHORD_TOLERANCE requires ARC_SEGMENT_MIN_TIME."
+  #endif
+  static_assert(ARC_CHORD_TOLERANCE >= 0, "ARC_CHORD_TOLERANCE must be 0 or greater.");
+#endif
+
+/**
+ * Sanity check for Fast Scan Probing
+ */
+#if ENABLED(PROBE_FAST_SCAN)
+  #if !HAS_BED_PROBE
+    #error "PROBE_FAST_SCAN requires a bed probe."
+  #elif ANY(BLTOUCH, SENSORLESS_PROBING)
+    #error "PROBE_FAST_SCAN is not compatible with BLTOUCH or SENSORLESS_PROBING."
+  #elif IS_KINEMATIC
+    #error "PROBE_FAST_SCAN is not compatible with DELTA or SCARA."
+  #elif QUIET_PROBING
+    #error "PROBE_FAST_SCAN is not compatible with PROBING_HEATERS_OFF, PROBING_FANS_OFF, PROBING_STEPPERS_OFF, or DELAY_BEFORE_PROBING."
+  #endif
+  static_assert(PROBE_FAST_SCAN_HOP > 0, "PROBE_FAST_SCAN_HOP must be greater than 0.");
+  static_assert(PROBE_FAST_SCAN_DEPTH > 0, "PROBE_FAST_SCAN_DEPTH must be greater than 0.");
+#endif
+
+/**
+ * Sanity check for Thermistor Lookup Tables
+ */
+#if ENABLED(THERMISTOR_LUT)
+  static_assert(WITHIN(THERMISTOR_LUT_BITS, 4, 8), "THERMISTOR_LUT_BITS must be from 4 to 8.");
+#endif
+
+/**
+ * Sanity check for Model Predictive Control
+ */
+#if ENABLED(MPCTEMP)
+  #if ENABLED(PIDTEMP)
+    #error "MPCTEMP is incompatible with PIDTEMP. Disable one or the other."
+  #elif !HAS_HOTEND
+    #error "MPCTEMP requires at least one hotend."
+  #elif ENABLED(PID_EXTRUSION_SCALING)
+    #error "PID_EXTRUSION_SCALING is not needed with MPCTEMP, which models extrusion itself."
+  #endif
+  static_assert(WITHIN(MPC_SMOOTHING_FACTOR, 0, 1), "MPC_SMOOTHING_FACTOR must be from 0.0 to 1.0.");
+  static_assert(MPC_FEED_FORWARD_TIME > 0, "MPC_FEED_FORWARD_TIME must be greater than 0.");
+  static_assert(WITHIN(MPC_MAX, 1, 255), "MPC_MAX must be from 1 to 255.");
+#endif
+
+/**
+ * Sanity check for TFT dirty regions
+ */
+#if ENABLED(TFT_DIRTY_REGIONS)
+  #if !HAS_GRAPHICAL_TFT
+    #error "TFT_DIRTY_REGIONS requires TFT_COLOR_UI."
+  #elif !WITHIN(TFT_DIRTY_REGION_COUNT, 1, 255)
+    #error "TFT_DIRTY_REGION_COUNT must be from 1 to 255."
+  #endif
+#endif
+
+/**
+ * Sanity check for the TFT drawing pipeline
+ */
+#if ENABLED(TFT_DOUBLE_BUFFER) && !HAS_GRAPHICAL_TFT
+  #error "TFT_DOUBLE_BUFFER requires TFT_COLOR_UI."
+#endif
+#ifdef TFT_FRAME_BUDGET_MS
+  #if !HAS_GRAPHICAL_TFT
+    #error "TFT_FRAME_BUDGET_MS requires TFT_COLOR_UI."
+  #elif !WITHIN(TFT_FRAME_BUDGET_MS, 1, 50)
+    #error "TFT_FRAME_BUDGET_MS must be from 1 to 50."
+  #endif
+#endif
+
+/**
+ * Sanity check for graphical display page drawing
+ */
+#if ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+  #if !HAS_MARLINUI_U8GLIB
+    #error "DOGM_SKIP_UNCHANGED_PAGES requires a u8glib graphical display."
+  #elif ENABLED(LIGHTWEIGHT_UI)
+    #error "DOGM_SKIP_UNCHANGED_PAGES is not compatible with LIGHTWEIGHT_UI."
+  #elif TFT_SCALED_DOGLCD
+    #error "DOGM_SKIP_UNCHANGED_PAGES is not compatible with upscaled TFT displays."
+  #endif
+#endif
+#ifdef DOGM_PAGE_BUDGET_MS
+  #if !HAS_MARLINUI_U8GLIB
+    #error "DOGM_PAGE_BUDGET_MS requires a u8glib graphical display."
+  #elif !WITHIN(DOGM_PAGE_BUDGET_MS, 1, 50)
+    #error "DOGM_PAGE_BUDGET_MS must be from 1 to 50."
+  #endif
+#endif
+
+/**
+ * Sanity check for the flash EEPROM log
+ */
+#if ENABLED(FLASH_EEPROM_LOG) && (DISABLED(EEPROM_SETTINGS) || !defined(ARDUINO_ARCH_STM32) || defined(STM32GENERIC))
+  #error "FLASH_EEPROM_LOG requires EEPROM_SETTINGS on STM32F4 with FLASH_EEPROM_LEVELING."
+#endif
+
 // Misc. Cleanup
 #undef _TEST_PWM
@@ -59,6 +59,10 @@
   #include "../../libs/duration_t.h"
 #endif
 
+#if ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+  #include "../../libs/crc16.h"
+#endif
+
 #if ENABLED(AUTO_BED_LEVELING_UBL)
   #include "../../feature/bedlevel/bedlevel.h"
 #endif
@@ -239,6 +243,64 @@ bool MarlinUI::detected() { return true; }
 #endif
 
 // Initialize or re-initialize the LCD
+#if ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+
+  bool u8g_page_unchanged; // = false
+
+  static u8g_dev_fnptr u8g_display_fn;                 // The display's own device function
+  static uint16_t page_crc[(LCD_PIXEL_HEIGHT) / 8];     // CRC of the last data sent for each page
+  static uint8_t pages_known;                           // Bits for the pages with a valid CRC
+  static uint8_t frames_to_redraw;                      // Frames until every page is sent again
+
+  static_assert(COUNT(page_crc) <= 8, "DOGM_SKIP_UNCHANGED_PAGES can't track more than 8 pages.");
+
+  // Send every page on this frame interval, to repair any that noise has garbled on the display
+  constexpr uint8_t redraw_frames = 20;
+
+  /**
+   * Stand-in for the display device function that passes each page
+   * through to the display only if it differs from the last one sent.
+   * An unchanged page still goes through the device, to step the page
+   * buffer, but with its output sent to the null com function.
+   */
+  static uint8_t u8g_dev_skip_unchanged_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
+    switch (msg) {
+      case U8G_DEV_MSG_INIT: pages_known = 0; break;
+
+      case U8G_DEV_MSG_PAGE_FIRST:
+        if (!frames_to_redraw--) {
+          pages_known = 0;
+          frames_to_redraw = redraw_frames - 1;
+        }
+        break;
+
+      case U8G_DEV_MSG_PAGE_NEXT: {
+        const u8g_pb_t * const pb = (u8g_pb_t *)dev->dev_mem;
+        const uint8_t page = pb->p.page;
+        if (page >= COUNT(page_crc)) break;
+
+        uint16_t crc = 0;
+        crc16(&crc, pb->buf, uint16_t(pb->width) * pb->p.page_height / 8);
+        if (!TEST(pages_known, page) || crc != page_crc[page]) {
+          page_crc[page] = crc;
+          SBI(pages_known, page);
+          break;
+        }
+
+        const u8g_com_fnptr com_fn = dev->com_fn;
+        dev->com_fn = u8g_com_null_fn;
+        u8g_page_unchanged = true;
+        const uint8_t r = u8g_display_fn(u8g, dev, msg, arg);
+        u8g_page_unchanged = false;
+        dev->com_fn = com_fn;
+        return r;
+      }
+    }
+    return u8g_display_fn(u8g, dev, msg, arg);
+  }
+
+#endif // DOGM_SKIP_UNCHANGED_PAGES
+
 void MarlinUI::init_lcd() {
   #if PIN_EXISTS(LCD_BACKLIGHT)
     OUT_WRITE(LCD_BACKLIGHT_PIN, DISABLED(DELAYED_BACKLIGHT_INIT)); // Illuminate after reset or right away
@@ -260,6 +322,19 @@ void MarlinUI::init_lcd() {
     u8g.begin();
   #endif
 
+  #if ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+    // Wrap the display device on the first call only. Later calls (e.g., on
+    // SD insert) find the rotation device in front of the display.
+    static bool dev_wrapped; // = false
+    if (!dev_wrapped) {
+      u8g_dev_t * const dev = u8g.getU8g()->dev;
+      u8g_display_fn = dev->dev_fn;
+      dev->dev_fn = u8g_dev_skip_unchanged_fn;
+      dev_wrapped = true;
+    }
+    pages_known = 0;
+  #endif
+
   #if PIN_EXISTS(LCD_BACKLIGHT) && ENABLED(DELAYED_BACKLIGHT_INIT)
     WRITE(LCD_BACKLIGHT_PIN, HIGH);
   #endif
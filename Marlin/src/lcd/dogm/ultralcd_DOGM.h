@@ -220,3 +220,7 @@
 #define PAGE_CONTAINS(ya, yb) ((yb) >= u8g.getU8g()->current_page.y0 && (ya) <= u8g.getU8g()->current_page.y1) // Do two vertical regions overlap?
 
 extern U8G_CLASS u8g;
+
+#if ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+  extern bool u8g_page_unchanged; // Devices that don't write through com_fn should not send this page
+#endif
@@ -33,6 +33,10 @@
 
 #include "ultralcd_st7920_u8glib_rrd_AVR.h"
 
+#if ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+  #include "ultralcd_DOGM.h"
+#endif
+
 #ifndef ST7920_DELAY_1
   #ifdef BOARD_ST7920_DELAY_1
     #define ST7920_DELAY_1 BOARD_ST7920_DELAY_1
@@ -116,6 +120,9 @@ uint8_t u8g_dev_rrd_st7920_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
     case U8G_DEV_MSG_STOP: break;
 
     case U8G_DEV_MSG_PAGE_NEXT: {
+      // The display still shows this page
+      if (TERN0(DOGM_SKIP_UNCHANGED_PAGES, u8g_page_unchanged)) break;
+
       uint8_t* ptr;
       u8g_pb_t* pb = (u8g_pb_t*)(dev->dev_mem);
       y = pb->p.page_y0;
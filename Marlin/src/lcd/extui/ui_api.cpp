@@ -827,6 +827,7 @@ namespace ExtUI {
         if (WITHIN(pos.x, 0, GRID_MAX_POINTS_X) && WITHIN(pos.y, 0, GRID_MAX_POINTS_Y)) {
           Z_VALUES(pos.x, pos.y) = zoff;
           TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+          TERN_(UBL_CELL_CACHE, ubl.refresh_cell_cache(pos.x, pos.y));
         }
       }
       float getMeshFadeHeight() { return planner.z_fade_height; };
@@ -202,6 +202,7 @@
 #if ENABLED(MESH_EDIT_MENU)
 
   inline void refresh_planner() {
+    TERN_(UBL_CELL_CACHE, ubl.refresh_cell_cache());
     set_current_from_steppers_for_axis(ALL_AXES);
     sync_plan_position();
   }
@@ -29,23 +29,33 @@
 uint16_t CANVAS::width, CANVAS::height;
 uint16_t CANVAS::startLine, CANVAS::endLine;
 uint16_t *CANVAS::buffer = TFT::buffer;
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  bool CANVAS::drawn;
+#endif
 
 void CANVAS::New(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
   CANVAS::width = width;
   CANVAS::height = height;
   startLine = 0;
   endLine = 0;
+  TERN_(TFT_DOUBLE_BUFFER, drawn = false);
 
   tft.set_window(x, y, x + width - 1, y + height - 1);
 }
 
 void CANVAS::Continue() {
   startLine = endLine;
-  endLine = TFT_BUFFER_SIZE < width * (height - startLine) ? startLine + TFT_BUFFER_SIZE / width : height;
+  endLine = CANVAS_BUFFER_SIZE < width * (height - startLine) ? startLine + CANVAS_BUFFER_SIZE / width : height;
+  TERN_(TFT_DOUBLE_BUFFER, drawn = true);
 }
 
 bool CANVAS::ToScreen() {
   tft.write_sequence(buffer, width * (endLine - startLine));
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    // Draw the next stripe in the other half while DMA sends this one
+    buffer = buffer == TFT::buffer ? TFT::buffer + CANVAS_BUFFER_SIZE : TFT::buffer;
+    drawn = false;
+  #endif
   return endLine == height;
 }
 
@@ -33,6 +33,9 @@ class CANVAS {
     static uint16_t width, height;
     static uint16_t startLine, endLine;
     static uint16_t *buffer;
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      static bool drawn;  // The stripe in buffer is drawn and waits to be sent
+    #endif
 
     inline static font_t *Font() { return TFT_String::font(); }
     inline static glyph_t *Glyph(uint8_t *character) { return TFT_String::glyph(character); }
@@ -45,6 +48,9 @@ class CANVAS {
     static void New(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
     static void Continue();
     static bool ToScreen();
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      inline static bool Drawn() { return drawn; }
+    #endif
 
     static void SetBackground(uint16_t color);
     static void AddText(uint16_t x, uint16_t y, uint16_t color, uint8_t *string, uint16_t maxWidth);
@@ -57,6 +57,17 @@
   #error "TFT_BUFFER_SIZE can not exceed 65535"
 #endif
 
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  #define CANVAS_BUFFER_SIZE (TFT_BUFFER_SIZE / 2)
+  #if TFT_BUFFER_SIZE % 4
+    #error "TFT_DOUBLE_BUFFER requires a TFT_BUFFER_SIZE that is a multiple of 4."
+  #elif CANVAS_BUFFER_SIZE < TFT_WIDTH
+    #error "TFT_DOUBLE_BUFFER requires a TFT_BUFFER_SIZE of at least two screen lines."
+  #endif
+#else
+  #define CANVAS_BUFFER_SIZE TFT_BUFFER_SIZE
+#endif
+
 class TFT {
   private:
     static TFT_String string;
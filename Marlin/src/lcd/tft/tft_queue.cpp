@@ -28,12 +28,107 @@
 #include "tft.h"
 #include "tft_image.h"
 
+#ifdef TFT_FRAME_BUDGET_MS
+  #include "../../module/planner.h"
+#endif
+
 uint8_t TFT_Queue::queue[];
 uint8_t *TFT_Queue::end_of_queue = queue;
 uint8_t *TFT_Queue::current_task = NULL;
 uint8_t *TFT_Queue::last_task = NULL;
 
+#if ENABLED(TFT_DIRTY_REGIONS)
+
+  screenRegion_t TFT_Queue::regions[TFT_DIRTY_REGION_COUNT];
+  uint8_t TFT_Queue::next_region = 0;
+  uint32_t TFT_Queue::queued_pixels = 0, TFT_Queue::queued_skipped = 0,
+           TFT_Queue::frame_pixels = 0, TFT_Queue::frame_skipped = 0,
+           TFT_Queue::total_pixels = 0, TFT_Queue::total_skipped = 0,
+           TFT_Queue::frames = 0;
+
+  // The queue is drained. That's a frame.
+  void TFT_Queue::end_frame() {
+    frame_pixels = queued_pixels;
+    frame_skipped = queued_skipped;
+    total_pixels += queued_pixels;
+    total_skipped += queued_skipped;
+    frames++;
+    queued_pixels = queued_skipped = 0;
+  }
+
+  void TFT_Queue::reset_stats() {
+    total_pixels = total_skipped = frames = 0;
+  }
+
+  // FNV-1a. Never 0, which marks an unknown region.
+  static uint32_t hash_bytes(const uint8_t *data, const uint8_t *end) {
+    uint32_t hash = 2166136261UL;
+    while (data < end) hash = (hash ^ *data++) * 16777619UL;
+    return hash ?: 1;
+  }
+
+  /**
+   * Forget what was drawn in any region that overlaps the given area
+   */
+  void TFT_Queue::invalidate(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+    for (screenRegion_t &region : regions)
+      if (region.hash && region.x < x + width && x < region.x + region.width && region.y < y + height && y < region.y + region.height)
+        region.hash = 0;
+  }
+
+  /**
+   * Check a finished canvas sketch against what was last queued for the same region.
+   * If nothing changed drop it from the queue. Otherwise remember it for next time.
+   */
+  bool TFT_Queue::unchanged(queueTask_t *task) {
+    parametersCanvas_t *task_parameters = (parametersCanvas_t *)(((uint8_t *)task) + sizeof(queueTask_t));
+    const uint16_t x = task_parameters->x, y = task_parameters->y,
+                   width = task_parameters->width, height = task_parameters->height;
+    const uint32_t pixels = uint32_t(width) * height,
+                   hash = hash_bytes((uint8_t *)task_parameters, end_of_queue);
+
+    screenRegion_t *slot = NULL;
+    for (screenRegion_t &region : regions) {
+      if (region.x == x && region.y == y && region.width == width && region.height == height) {
+        if (region.hash == hash) {
+          // The screen already shows this, or will when the queue gets to it
+          end_of_queue = (uint8_t *)task;
+          *end_of_queue = TASK_END_OF_QUEUE;
+          if (current_task == (uint8_t *)task) current_task = NULL;
+          last_task = NULL;
+          queued_skipped += pixels;
+          return true;
+        }
+        slot = &region;
+        break;
+      }
+    }
+
+    invalidate(x, y, width, height);
+
+    if (!slot) {
+      slot = &regions[next_region];
+      if (++next_region >= COUNT(regions)) next_region = 0;
+    }
+    slot->x = x;
+    slot->y = y;
+    slot->width = width;
+    slot->height = height;
+    slot->hash = hash;
+
+    queued_pixels += pixels;
+    return false;
+  }
+
+#endif // TFT_DIRTY_REGIONS
+
 void TFT_Queue::reset() {
+  #if ENABLED(TFT_DIRTY_REGIONS)
+    // Queued drawing about to be aborted never makes it to the screen
+    if (current_task && ((queueTask_t *)current_task)->type != TASK_END_OF_QUEUE)
+      for (screenRegion_t &region : regions) region.hash = 0;
+  #endif
+
   tft.abort();
 
   end_of_queue = queue;
@@ -42,11 +137,39 @@ void TFT_Queue::reset() {
 }
 
 void TFT_Queue::async() {
-  if (current_task == NULL) return;
+  #ifdef TFT_FRAME_BUDGET_MS
+    // Keep going for the time budget, but hand idle() back as soon as the planner runs short
+    const millis_t stop_ms = millis() + TFT_FRAME_BUDGET_MS;
+    while (process() && PENDING(millis(), stop_ms)
+      && (!planner.has_blocks_queued() || planner.movesplanned() >= (BLOCK_BUFFER_SIZE) / 2)
+    ) { /* nada */ }
+  #else
+    process();
+  #endif
+}
+
+/**
+ * Do the next piece of work. Return false if there is nothing to do until the IO is free.
+ */
+bool TFT_Queue::process() {
+  if (current_task == NULL) {
+    // Everything since the last frame was skipped
+    TERN_(TFT_DIRTY_REGIONS, if (queued_skipped) end_frame());
+    return false;
+  }
   queueTask_t *task = (queueTask_t *)current_task;
 
   // Check IO busy status
-  if (tft.is_busy()) return;
+  if (tft.is_busy()) {
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      // Draw the next stripe of the canvas being sent
+      if (task->type == TASK_CANVAS && task->state == TASK_STATE_IN_PROGRESS && !Canvas.Drawn()) {
+        canvas(task);
+        return true;
+      }
+    #endif
+    return false;
+  }
 
   if (task->state == TASK_STATE_COMPLETED) {
     task = (queueTask_t *)task->nextTask;
@@ -56,10 +179,11 @@ void TFT_Queue::async() {
   finish_sketch();
 
   switch (task->type) {
-    case TASK_END_OF_QUEUE: reset();      break;
+    case TASK_END_OF_QUEUE: TERN_(TFT_DIRTY_REGIONS, end_frame()); reset(); break;
     case TASK_FILL:         fill(task);   break;
     case TASK_CANVAS:       canvas(task); break;
   }
+  return true;
 }
 
 void TFT_Queue::finish_sketch() {
@@ -67,6 +191,8 @@ void TFT_Queue::finish_sketch() {
   queueTask_t *task = (queueTask_t *)last_task;
 
   if (task->state == TASK_STATE_SKETCH) {
+    if (TERN0(TFT_DIRTY_REGIONS, unchanged(task))) return;
+
     *end_of_queue = TASK_END_OF_QUEUE;
     task->nextTask = end_of_queue;
     task->state = TASK_STATE_READY;
@@ -107,6 +233,15 @@ void TFT_Queue::canvas(queueTask_t *task) {
     task->state = TASK_STATE_IN_PROGRESS;
     Canvas.New(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height);
   }
+
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    // The stripe was drawn while the last one was sent
+    if (Canvas.Drawn()) {
+      if (Canvas.ToScreen()) task->state = TASK_STATE_COMPLETED;
+      return;
+    }
+  #endif
+
   Canvas.Continue();
 
   for (i = 0; i < task_parameters->count; i++) {
@@ -158,6 +293,9 @@ void TFT_Queue::canvas(queueTask_t *task) {
     }
   }
 
+  // Send it later if the last stripe is still going out
+  if (TERN0(TFT_DOUBLE_BUFFER, tft.is_busy())) return;
+
   if (Canvas.ToScreen()) task->state = TASK_STATE_COMPLETED;
 }
 
@@ -165,6 +303,11 @@ void TFT_Queue::canvas(queueTask_t *task) {
 void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
   finish_sketch();
 
+  #if ENABLED(TFT_DIRTY_REGIONS)
+    invalidate(x, y, width, height);
+    queued_pixels += uint32_t(width) * height;
+  #endif
+
   queueTask_t *task = (queueTask_t *)end_of_queue;
   last_task = (uint8_t *)task;
 
@@ -111,6 +111,16 @@ typedef struct __attribute__((__packed__)) {
   uint16_t color;
 } parametersCanvasRectangle_t;
 
+#if ENABLED(TFT_DIRTY_REGIONS)
+  typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint32_t hash;  // Of the canvas last queued for the region. 0 if unknown.
+  } screenRegion_t;
+#endif
+
 class TFT_Queue {
   private:
     static uint8_t queue[QUEUE_SIZE];
@@ -118,11 +128,28 @@ class TFT_Queue {
     static uint8_t *current_task;
     static uint8_t *last_task;
 
+    static bool process();
     static void finish_sketch();
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
 
+    #if ENABLED(TFT_DIRTY_REGIONS)
+      static screenRegion_t regions[TFT_DIRTY_REGION_COUNT];
+      static uint8_t next_region;
+      static uint32_t queued_pixels, queued_skipped;
+      static bool unchanged(queueTask_t *task);
+      static void invalidate(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+      static void end_frame();
+    #endif
+
   public:
+    #if ENABLED(TFT_DIRTY_REGIONS)
+      static uint32_t frame_pixels, frame_skipped,  // Pixels sent and skipped as unchanged in the last frame
+                      total_pixels, total_skipped;  // Since the last stats reset
+      static uint32_t frames;
+      static void reset_stats();
+    #endif
+
     static void reset();
     static void async();
     static void sync() { while (current_task != NULL) async(); }
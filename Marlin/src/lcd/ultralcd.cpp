@@ -1025,7 +1025,7 @@ void MarlinUI::update() {
           constexpr bool do_u8g_loop = true;
         #endif
 
-        if (do_u8g_loop) {
+        while (do_u8g_loop) {
           if (!drawing_screen) {                // If not already drawing pages
             u8g.firstPage();                    // Start the first page
             drawing_screen = first_page = true; // Flag as drawing pages
@@ -1039,10 +1039,14 @@ void MarlinUI::update() {
           // If still drawing and there's another page, update max-time and return now.
           // The nextPage will already be set up on the next call.
           if (drawing_screen && (drawing_screen = u8g.nextPage())) {
+            #ifdef DOGM_PAGE_BUDGET_MS
+              if (PENDING(millis(), ms + DOGM_PAGE_BUDGET_MS)) continue; // Time for another page
+            #endif
             if (on_status_screen())
               NOLESS(max_display_update_time, millis() - ms);
             return;
           }
+          break;
         }
 
       #else
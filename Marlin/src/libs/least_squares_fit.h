@@ -86,4 +86,24 @@ inline void incremental_LSF(struct linear_fit_data *lsf, const xy_pos_t &pos, co
   incremental_LSF(lsf, pos.x, pos.y, z);
 }
 
+// Scale all accumulators by w, as if every sample so far had been given weight w
+inline void incremental_LSF_scale(struct linear_fit_data *lsf, const float &w) {
+  lsf->xbar  *= w; lsf->ybar  *= w; lsf->zbar  *= w;
+  lsf->x2bar *= w; lsf->y2bar *= w; lsf->z2bar *= w;
+  lsf->xybar *= w; lsf->xzbar *= w; lsf->yzbar *= w;
+  lsf->N     *= w;
+  lsf->max_absx *= w;
+  lsf->max_absy *= w;
+}
+
+// Merge the samples accumulated in src into lsf with an extra weight of w
+inline void incremental_LSF_merge(struct linear_fit_data *lsf, const struct linear_fit_data *src, const float &w) {
+  lsf->xbar  += w * src->xbar;  lsf->ybar  += w * src->ybar;  lsf->zbar  += w * src->zbar;
+  lsf->x2bar += w * src->x2bar; lsf->y2bar += w * src->y2bar; lsf->z2bar += w * src->z2bar;
+  lsf->xybar += w * src->xybar; lsf->xzbar += w * src->xzbar; lsf->yzbar += w * src->yzbar;
+  lsf->N     += w * src->N;
+  lsf->max_absx = _MAX(w * src->max_absx, lsf->max_absx);
+  lsf->max_absy = _MAX(w * src->max_absy, lsf->max_absy);
+}
+
 int finish_incremental_LSF(struct linear_fit_data *);
@@ -139,6 +139,18 @@ void inverse_kinematics(const xyz_pos_t &raw) {
   #endif
 }
 
+// Hotend offsets move the towers instead of each point. The loops only
+// vectorize with -fno-math-errno, which common-cxxflags.py sets for this file.
+void _O3 inverse_kinematics(const xyze_pos_t raw[], abc_pos_t abc[], const uint8_t n) {
+  LOOP_ABC(t) {
+    const float tx = delta_tower[t].x TERN_(HAS_HOTEND_OFFSET, + hotend_offset[active_extruder].x),
+                ty = delta_tower[t].y TERN_(HAS_HOTEND_OFFSET, + hotend_offset[active_extruder].y),
+                rod2 = delta_diagonal_rod_2_tower[t];
+    for (uint8_t i = 0; i < n; i++)
+      abc[i][t] = raw[i].z + SQRT(rod2 - HYPOT2(tx - raw[i].x, ty - raw[i].y));
+  }
+}
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -89,6 +89,22 @@ void recalc_delta_settings();
 
 void inverse_kinematics(const xyz_pos_t &raw);
 
+/**
+ * Delta Inverse Kinematics for a batch of points
+ *
+ * Fill abc[] with the tower positions for n (up to DELTA_IK_BATCH)
+ * machine positions. Each tower is a loop over the points with no
+ * dependency between iterations, so the square roots can overlap
+ * in the FPU pipeline or be vectorized.
+ */
+#ifdef __AVR__
+  #define DELTA_IK_BATCH 1  // No FPU to keep busy
+#else
+  #define DELTA_IK_BATCH 8
+#endif
+
+void inverse_kinematics(const xyze_pos_t raw[], abc_pos_t abc[], const uint8_t n);
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -720,6 +720,113 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     #define SCARA_MIN_SEGMENT_LENGTH 0.5f
   #endif
 
+  #ifdef DELTA_SEGMENT_TOLERANCE
+
+    /**
+     * Apply the position modifiers (skew, leveling, retraction) and inverse
+     * kinematics to one point of a move. The modified E is left in 'pos'.
+     */
+    inline abc_pos_t delta_modified_ik(xyze_pos_t &pos) {
+      TERN_(HAS_POSITION_MODIFIERS, planner.apply_modifiers(pos));
+      inverse_kinematics(pos);
+      return delta;
+    }
+
+    #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+      /**
+       * Distance along the move from 'pos' to the next mesh line on one axis.
+       * 'rate' is the axis change per mm of the move. Lines less than 0.1% of
+       * the spacing ahead are skipped so a segment ending on a line moves on.
+       */
+      static float mm_to_mesh_line(const float pos, const float rate, const float first, const float spacing, const int16_t last, const float none) {
+        if (!rate) return none;
+        const float g = (pos - first) / spacing;
+        int16_t k;
+        if (rate > 0) { k = FLOOR(g + 0.001f) + 1; if (k > last) return none; NOLESS(k, 0); }
+        else          { k = CEIL(g - 0.001f) - 1;  if (k < 0) return none;    NOMORE(k, last); }
+        return (first + k * spacing - pos) / rate;
+      }
+    #endif
+
+    /**
+     * Split a delta move only where it is needed. The steppers move the
+     * towers linearly over a segment, so the effector strays from the straight
+     * line most near the segment's middle. Each segment starts out as long as
+     * possible and is halved until the tower positions of its leveled middle
+     * point are within DELTA_SEGMENT_TOLERANCE of the tower path. The old middle
+     * becomes the new end, so each halving costs one inverse kinematics call,
+     * and the end's tower positions go to the planner as they are.
+     *
+     * With bilinear leveling, segments also end on mesh lines so the leveled
+     * path follows the mesh. Segments longer than min_segment_mm, given by
+     * DELTA_SEGMENTS_PER_SECOND, are checked, so halving stops at half of it.
+     */
+    static void delta_adaptive_line_to_destination(const xyze_float_t &diff, const float cartesian_mm, const float min_segment_mm, const feedRate_t &scaled_fr_mm_s) {
+      const xyze_pos_t start = current_position;
+      const xyze_float_t rate = diff * RECIPROCAL(cartesian_mm);  // Change per mm of the move
+
+      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+        const bool to_mesh_lines = planner.leveling_active;
+        const xy_float_t spacing = bilinear_grid_spacing / float(TERN(ABL_BILINEAR_SUBDIVISION, BILINEAR_SUBDIVISIONS, 1));
+        constexpr xy_int_t last = {
+          (GRID_MAX_POINTS_X - 1) * TERN(ABL_BILINEAR_SUBDIVISION, BILINEAR_SUBDIVISIONS, 1),
+          (GRID_MAX_POINTS_Y - 1) * TERN(ABL_BILINEAR_SUBDIVISION, BILINEAR_SUBDIVISIONS, 1)
+        };
+      #endif
+
+      xyze_pos_t raw = start, lev = raw;
+      abc_pos_t abc0 = delta_modified_ik(lev);
+
+      float done_mm = 0, try_mm = cartesian_mm;
+      millis_t next_idle_ms = millis() + 200UL;
+      for (;;) {
+        segment_idle(next_idle_ms);
+
+        float end_mm = done_mm + try_mm;
+
+        #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          if (to_mesh_lines) {
+            NOMORE(end_mm, done_mm + mm_to_mesh_line(raw.x, rate.x, bilinear_start.x, spacing.x, last.x, try_mm));
+            NOMORE(end_mm, done_mm + mm_to_mesh_line(raw.y, rate.y, bilinear_start.y, spacing.y, last.y, try_mm));
+          }
+        #endif
+
+        xyze_pos_t end_raw = end_mm < cartesian_mm ? start + diff * (end_mm / cartesian_mm) : destination;
+        if (end_mm > cartesian_mm) end_mm = cartesian_mm;
+        xyze_pos_t end_lev = end_raw;
+        abc_pos_t abc1 = delta_modified_ik(end_lev);
+
+        bool halved = false;
+        while (end_mm - done_mm > min_segment_mm) {
+          const float mid_mm = (done_mm + end_mm) * 0.5f;
+          const xyze_pos_t mid_raw = start + diff * (mid_mm / cartesian_mm);
+          xyze_pos_t mid_lev = mid_raw;
+          const abc_pos_t abcm = delta_modified_ik(mid_lev);
+          const abc_float_t err = (abcm - (abc0 + abc1) * 0.5f).ABS();
+          if (_MAX(err.a, err.b, err.c) <= float(DELTA_SEGMENT_TOLERANCE)) break;
+          end_mm = mid_mm;
+          end_raw = mid_raw;
+          end_lev = mid_lev;
+          abc1 = abcm;
+          halved = true;
+        }
+
+        const float segment_mm = end_mm - done_mm;
+        if (!planner.buffer_delta_segment(end_raw, abc1, end_lev.e, scaled_fr_mm_s, active_extruder, segment_mm)) return;
+        if (end_mm >= cartesian_mm) return;
+
+        // Grow again after a segment that needed no halving and wasn't cut short
+        if (halved) try_mm = segment_mm;
+        else if (segment_mm >= try_mm) try_mm *= 2;
+
+        done_mm = end_mm;
+        raw = end_raw;
+        abc0 = abc1;
+      }
+    }
+
+  #endif // DELTA_SEGMENT_TOLERANCE
+
   /**
    * Prepare a linear move in a DELTA or SCARA setup.
    *
@@ -775,6 +882,12 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     // At least one segment is required
     NOLESS(segments, 1U);
 
+    #ifdef DELTA_SEGMENT_TOLERANCE
+      // The fixed segment length now limits how far segments are halved
+      delta_adaptive_line_to_destination(diff, cartesian_mm, cartesian_mm / segments, scaled_fr_mm_s);
+      return false; // caller will update current_position
+    #endif
+
     // The approximate length of each segment
     const float inv_segments = 1.0f / float(segments),
                 cartesian_segment_mm = cartesian_mm * inv_segments;
@@ -797,22 +910,42 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
     // Calculate and execute the segments
     millis_t next_idle_ms = millis() + 200UL;
-    while (--segments) {
-      segment_idle(next_idle_ms);
-      raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
+
+    #if ENABLED(DELTA)
+
+      // Buffer the segments in batches for the batched inverse kinematics.
+      // The last segment of the last batch ends exactly at the destination.
+      xyze_pos_t batch[DELTA_IK_BATCH];
+      while (segments) {
+        segment_idle(next_idle_ms);
+        uint8_t n = 0;
+        do {
+          raw += segment_distance;
+          batch[n++] = --segments ? raw : destination;
+        } while (segments && n < DELTA_IK_BATCH);
+        if (!planner.buffer_lines(batch, n, scaled_fr_mm_s, active_extruder, cartesian_segment_mm)) break;
+      }
+
+    #else
+
+      while (--segments) {
+        segment_idle(next_idle_ms);
+        raw += segment_distance;
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
+          #if ENABLED(SCARA_FEEDRATE_SCALING)
+            , inv_duration
+          #endif
+        )) break;
+      }
+
+      // Ensure last segment arrives at target location.
+      planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
         #if ENABLED(SCARA_FEEDRATE_SCALING)
           , inv_duration
         #endif
-      )) break;
-    }
+      );
 
-    // Ensure last segment arrives at target location.
-    planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
-      #if ENABLED(SCARA_FEEDRATE_SCALING)
-        , inv_duration
-      #endif
-    );
+    #endif
 
     return false; // caller will update current_position
   }
@@ -1315,6 +1448,9 @@ void do_homing_move(const AxisEnum axis, const float distance, const feedRate_t
     TERN_(SENSORLESS_HOMING, stealth_states = start_sensorless_homing_per_axis(axis));
   }
 
+  // Delayed steps would carry the axis on after the endstop triggers
+  TERN_(INPUT_SHAPING, stepper.shaping_bypass = true);
+
   #if IS_SCARA
     // Tell the planner the axis is at 0
     current_position[axis] = 0;
@@ -1344,6 +1480,8 @@ void do_homing_move(const AxisEnum axis, const float distance, const feedRate_t
 
   planner.synchronize();
 
+  TERN_(INPUT_SHAPING, stepper.shaping_bypass = false);
+
   if (is_home_dir) {
 
     #if HOMING_Z_WITH_PROBE && QUIET_PROBING
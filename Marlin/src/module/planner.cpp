@@ -111,6 +111,10 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(MOTION_BENCHMARK)
+  #include "../feature/benchmark.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100
@@ -942,7 +946,8 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
 */
 
 // The kernel called by recalculate() when scanning the plan from last to first entry.
-void Planner::reverse_pass_kernel(block_t* const current, const block_t * const next) {
+// Return true if the entry speed of the block changed.
+bool Planner::reverse_pass_kernel(block_t* const current, const block_t * const next) {
   if (current) {
     // If entry speed is already at the maximum entry speed, and there was no change of speed
     // in the next block, there is no need to recheck. Block is cruising and there is no need to
@@ -983,17 +988,23 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t * const
           // Block is not BUSY so this is ahead of the Stepper ISR:
           // Just Set the new entry speed.
           current->entry_speed_sqr = new_entry_speed_sqr;
+          return true;
         }
       }
     }
   }
+  return false;
 }
 
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the reverse pass.
+ *
+ * Return the index of the block where planning must resume. A block whose
+ * entry speed doesn't change leaves everything before it as it was, so the
+ * pass stops there and the forward pass and trapezoids start from it.
  */
-void Planner::reverse_pass() {
+uint8_t Planner::reverse_pass() {
   // Initialize block index to the last block in the planner buffer.
   uint8_t block_index = prev_block_index(block_buffer_head);
 
@@ -1004,7 +1015,7 @@ void Planner::reverse_pass() {
   // If there was a race condition and block_buffer_planned was incremented
   //  or was pointing at the head (queue empty) break loop now and avoid
   //  planning already consumed blocks
-  if (planned_block_index == block_buffer_head) return;
+  if (planned_block_index == block_buffer_head) return planned_block_index;
 
   // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
   // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
@@ -1017,7 +1028,9 @@ void Planner::reverse_pass() {
 
     // Only consider non sync and page blocks
     if (!TEST(current->flag, BLOCK_BIT_SYNC_POSITION) && !IS_PAGE(current)) {
-      reverse_pass_kernel(current, next);
+      TERN_(MOTION_BENCHMARK, motion_benchmark.recalc_count(MotionBenchmark::RECALC_REVERSE));
+      // The newest block was never forward planned, so it can't end the pass
+      if (!reverse_pass_kernel(current, next) && next) return block_index;
       next = current;
     }
 
@@ -1030,12 +1043,13 @@ void Planner::reverse_pass() {
     while (planned_block_index != block_buffer_planned) {
 
       // If we reached the busy block or an already processed block, break the loop now
-      if (block_index == planned_block_index) return;
+      if (block_index == planned_block_index) return planned_block_index;
 
       // Advance the pointer, following the busy block
       planned_block_index = next_block_index(planned_block_index);
     }
   }
+  return planned_block_index;
 }
 
 // The kernel called by recalculate() when scanning the plan from first to last entry.
@@ -1092,9 +1106,9 @@ void Planner::forward_pass_kernel(const block_t* const previous, block_t* const
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the forward pass.
  */
-void Planner::forward_pass() {
+void Planner::forward_pass(const uint8_t start_index) {
 
-  // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
+  // Forward Pass: Forward plan the acceleration curve from where the reverse pass stopped.
   // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
 
   // Begin at buffer planned pointer. Note that block_buffer_planned can be modified
@@ -1103,6 +1117,9 @@ void Planner::forward_pass() {
   //  pass will never modify the values at the tail.
   uint8_t block_index = block_buffer_planned;
 
+  // Skip ahead to the start block, unless the ISR has already passed it
+  if (block_in_range(start_index, block_index)) block_index = start_index;
+
   block_t *block;
   const block_t * previous = nullptr;
   while (block_index != block_buffer_head) {
@@ -1120,6 +1137,7 @@ void Planner::forward_pass() {
       if (!previous || !stepper.is_block_busy(previous))
         forward_pass_kernel(previous, block, block_index);
       previous = block;
+      TERN_(MOTION_BENCHMARK, motion_benchmark.recalc_count(MotionBenchmark::RECALC_FORWARD));
     }
     // Advance to the previous
     block_index = next_block_index(block_index);
@@ -1130,11 +1148,18 @@ void Planner::forward_pass() {
  * Recalculate the trapezoid speed profiles for all blocks in the plan
  * according to the entry_factor for each junction. Must be called by
  * recalculate() after updating the blocks.
+ *
+ * Blocks before start_index have no changed junctions, so the scan
+ * begins there instead of at the tail.
  */
-void Planner::recalculate_trapezoids() {
+void Planner::recalculate_trapezoids(const uint8_t start_index) {
   // The tail may be changed by the ISR so get a local copy.
   uint8_t block_index = block_buffer_tail,
           head_block_index = block_buffer_head;
+
+  // Skip ahead to the start block, unless the ISR has already passed it
+  if (block_in_range(start_index, block_index)) block_index = start_index;
+
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
   // specially handled), scan backwards to the first non-SYNC block.
@@ -1162,6 +1187,7 @@ void Planner::recalculate_trapezoids() {
 
     // Skip sync and page blocks
     if (!TEST(next->flag, BLOCK_BIT_SYNC_POSITION) && !IS_PAGE(next)) {
+      TERN_(MOTION_BENCHMARK, motion_benchmark.recalc_count(MotionBenchmark::RECALC_TRAPEZOID));
       next_entry_speed = SQRT(next->entry_speed_sqr);
 
       if (block) {
@@ -1238,14 +1264,17 @@ void Planner::recalculate_trapezoids() {
 }
 
 void Planner::recalculate() {
+  TERN_(MOTION_BENCHMARK, BENCHMARK_SCOPE(RECALCULATE));
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
   // If there is just one block, no planning can be done. Avoid it!
-  if (block_index != block_buffer_planned) {
-    reverse_pass();
-    forward_pass();
+  uint8_t start_index = block_buffer_planned;
+  if (block_index != start_index) {
+    start_index = reverse_pass();
+    forward_pass(start_index);
   }
-  recalculate_trapezoids();
+  recalculate_trapezoids(start_index);
+  TERN_(MOTION_BENCHMARK, motion_benchmark.recalc_done());
 }
 
 #if ENABLED(AUTOTEMP)
@@ -1274,6 +1303,31 @@ void Planner::recalculate() {
 
 #endif // AUTOTEMP
 
+#if ENABLED(MPCTEMP)
+
+  /**
+   * Average feedrate (mm/s) of filament into extruder e over the first 'horizon'
+   * seconds of the planner queue, for the hotend model to heat ahead of demand.
+   * Cruise rates are used, so time spent accelerating is slightly underestimated.
+   */
+  float Planner::planned_extrusion_speed(const uint8_t e, const float &horizon) {
+    float time = 0, e_mm = 0;
+    for (uint8_t b = block_buffer_tail; b != block_buffer_head && time < horizon; b = next_block_index(b)) {
+      const block_t * const block = &block_buffer[b];
+      if (TEST(block->flag, BLOCK_BIT_SYNC_POSITION) || IS_PAGE(block) || !block->nominal_rate) continue;
+      const float block_time = float(block->step_event_count) / block->nominal_rate;
+      if (block->extruder == e && block->steps.e && !TEST(block->direction_bits, E_AXIS)) {
+        // Count only the part of the last block that falls inside the horizon
+        const float part = _MIN(1.0f, (horizon - time) / block_time);
+        e_mm += part * block->steps.e * steps_to_mm[E_AXIS_N(e)];
+      }
+      time += block_time;
+    }
+    return time ? e_mm / _MIN(time, horizon) : 0;
+  }
+
+#endif
+
 /**
  * Maintain fans, paste extruder pressure,
  */
@@ -1602,7 +1656,7 @@ float Planner::triggered_position_mm(const AxisEnum axis) {
 }
 
 void Planner::finish_and_disable() {
-  while (has_blocks_queued() || cleaning_buffer_counter) idle();
+  while (has_blocks_queued() || cleaning_buffer_counter || TERN0(INPUT_SHAPING, stepper.shaping_busy())) idle();
   disable_all_steppers();
 }
 
@@ -1664,6 +1718,7 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 void Planner::synchronize() {
   while (has_blocks_queued() || cleaning_buffer_counter
       || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
+      || TERN0(INPUT_SHAPING, stepper.shaping_busy())
   ) idle();
 }
 
@@ -1697,6 +1752,8 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
 
+  TERN_(MOTION_BENCHMARK, BENCHMARK_SCOPE(PLAN));
+
   // Fill the block with the specified movement
   if (!_populate_block(block, false, target
     #if HAS_POSITION_FLOAT
@@ -1725,6 +1782,9 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   // Move buffer head
   block_buffer_head = next_buffer_head;
 
+  TERN_(MOTION_BENCHMARK, motion_benchmark.blocks_planned++);
+  TERN_(EVENT_TRACE, event_trace.record(TRACE_BLOCK_QUEUED, movesplanned()));
+
   // Recalculate and optimize trapezoidal speed profiles
   recalculate();
 
@@ -2689,6 +2749,8 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
   // If we are cleaning, do not accept queuing of movements
   if (cleaning_buffer_counter) return false;
 
+  TERN_(MOTION_BENCHMARK, motion_benchmark.segments++);
+
   // When changing extruders recalculate steps corresponding to the E position
   #if ENABLED(DISTINCT_E_FACTORS)
     if (last_extruder != extruder && settings.axis_steps_per_mm[E_AXIS_N(extruder)] != settings.axis_steps_per_mm[E_AXIS_N(last_extruder)]) {
@@ -2824,6 +2886,54 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
   #endif
 } // buffer_line()
 
+#if ENABLED(DELTA)
+
+  bool Planner::buffer_lines(const xyze_pos_t raw[], const uint8_t n, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters) {
+    xyze_pos_t machine[DELTA_IK_BATCH];
+    abc_pos_t abc[DELTA_IK_BATCH];
+    uint8_t i = 0;
+    do {
+      machine[i] = raw[i];
+      TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine[i]));
+    } while (++i < n);
+
+    inverse_kinematics(machine, abc, n);
+
+    for (i = 0; i < n; i++) {
+      #if HAS_JUNCTION_DEVIATION
+        const xyze_pos_t cart_dist_mm = raw[i] - position_cart;
+      #endif
+      if (!buffer_segment(abc[i].a, abc[i].b, abc[i].c, machine[i].e
+        #if HAS_JUNCTION_DEVIATION
+          , cart_dist_mm
+        #endif
+        , fr_mm_s, extruder, millimeters
+      )) return false;
+      position_cart = raw[i];
+    }
+    return true;
+  }
+
+#endif
+
+#ifdef DELTA_SEGMENT_TOLERANCE
+
+  bool Planner::buffer_delta_segment(const xyze_pos_t &cart, const abc_pos_t &abc, const float &e, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters) {
+    #if HAS_JUNCTION_DEVIATION
+      const xyze_pos_t cart_dist_mm = cart - position_cart;
+    #endif
+    if (!buffer_segment(abc.a, abc.b, abc.c, e
+      #if HAS_JUNCTION_DEVIATION
+        , cart_dist_mm
+      #endif
+      , fr_mm_s, extruder, millimeters
+    )) return false;
+    position_cart = cart;
+    return true;
+  }
+
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
 
   void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
@@ -62,6 +62,10 @@
   #include "../feature/mixing.h"
 #endif
 
+#if ENABLED(EVENT_TRACE)
+  #include "../feature/event_trace.h"
+#endif
+
 #if HAS_CUTTER
   #include "../feature/spindle_laser_types.h"
 #endif
@@ -774,6 +778,34 @@ class Planner {
       );
     }
 
+    #if ENABLED(DELTA)
+      /**
+       * Add 1 to DELTA_IK_BATCH delta segments of the same length
+       * with one batched inverse kinematics call.
+       *
+       *  raw         - target positions in mm
+       *  n           - number of positions
+       *  fr_mm_s     - (target) speed of the move (mm/s)
+       *  extruder    - target extruder
+       *  millimeters - the length of each segment
+       */
+      static bool buffer_lines(const xyze_pos_t raw[], const uint8_t n, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters);
+    #endif
+
+    #ifdef DELTA_SEGMENT_TOLERANCE
+      /**
+       * Add a delta segment whose tower positions the caller already
+       * worked out, with leveling and other modifiers applied.
+       *
+       *  cart        - target position in mm, before modifiers
+       *  abc, e      - target tower positions and E, after modifiers
+       *  fr_mm_s     - (target) speed of the move (mm/s)
+       *  extruder    - target extruder
+       *  millimeters - the length of the movement
+       */
+      static bool buffer_delta_segment(const xyze_pos_t &cart, const abc_pos_t &abc, const float &e, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters);
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -867,8 +899,10 @@ class Planner {
      * Called when the current block is no longer needed.
      */
     FORCE_INLINE static void release_current_block() {
-      if (has_blocks_queued())
+      if (has_blocks_queued()) {
         block_buffer_tail = next_block_index(block_buffer_tail);
+        TERN_(EVENT_TRACE, event_trace.record(TRACE_BLOCK_DONE, movesplanned()));
+      }
     }
 
     #if HAS_WIRED_LCD
@@ -884,6 +918,10 @@ class Planner {
       static void autotemp_update();
     #endif
 
+    #if ENABLED(MPCTEMP)
+      static float planned_extrusion_speed(const uint8_t e, const float &horizon);
+    #endif
+
     #if HAS_LINEAR_E_JERK
       FORCE_INLINE static void recalculate_max_e_jerk() {
         const float prop = junction_deviation_mm * SQRT(0.5) / (1.0f - SQRT(0.5));
@@ -942,13 +980,18 @@ class Planner {
 
     static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
 
-    static void reverse_pass_kernel(block_t* const current, const block_t * const next);
+    static bool reverse_pass_kernel(block_t* const current, const block_t * const next);
     static void forward_pass_kernel(const block_t * const previous, block_t* const current, uint8_t block_index);
 
-    static void reverse_pass();
-    static void forward_pass();
+    static uint8_t reverse_pass();
+    static void forward_pass(const uint8_t start_index);
 
-    static void recalculate_trapezoids();
+    static void recalculate_trapezoids(const uint8_t start_index);
+
+    // The block index is in the range [from, block_buffer_head)
+    FORCE_INLINE static bool block_in_range(const uint8_t block_index, const uint8_t from) {
+      return BLOCK_MOD(block_index - from) < BLOCK_MOD(block_buffer_head - from);
+    }
 
     static void recalculate();
 
@@ -641,6 +641,62 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
   return measured_z;
 }
 
+#if ENABLED(PROBE_FAST_SCAN)
+
+  bool Probe::scanning; // = false
+  float Probe::scan_z;
+
+  /**
+   * @brief Probe at the given nozzle XY, starting from the last contact.
+   *
+   * @details Rise PROBE_FAST_SCAN_HOP, move to the XY, and descend to
+   *          PROBE_FAST_SCAN_DEPTH below the last contact. The moves are
+   *          queued together so only the end of the descent is waited for.
+   *          The Z is the stepper position latched by the endstop ISR when
+   *          the probe triggered. If it didn't trigger, or triggered before
+   *          it was well down, probe the usual way with run_z_probe.
+   *
+   * @return The Z position of the bed at the given XY or NAN on error.
+   */
+  float Probe::scan_at_point(const xy_pos_t &npos, const bool sanity_check) {
+    DEBUG_SECTION(log_probe, "Probe::scan_at_point", DEBUGGING(LEVELING));
+
+    const float hop_z = scan_z + (PROBE_FAST_SCAN_HOP);
+    current_position.z = hop_z;
+    line_to_current_position(MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    current_position.set(npos.x, npos.y);
+    line_to_current_position(XY_PROBE_FEEDRATE_MM_S);
+    current_position.z = scan_z - (PROBE_FAST_SCAN_DEPTH);
+    line_to_current_position(MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    planner.synchronize();
+
+    const bool probe_triggered = TEST(endstops.trigger_state(), TERN(Z_MIN_PROBE_USES_Z_MIN_ENDSTOP_PIN, Z_MIN, Z_MIN_PROBE));
+    const float z = planner.triggered_position_mm(Z_AXIS);
+    endstops.hit_on_purpose();
+
+    // Get Z where the steppers were interrupted and tell the planner
+    set_current_from_steppers_for_axis(Z_AXIS);
+    sync_plan_position();
+
+    // A trigger right at the top means the probe never let go
+    if (probe_triggered && z < hop_z - 0.5f * (PROBE_FAST_SCAN_HOP)) return z;
+
+    if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Scan missed the bed. Probing the usual way.");
+    do_blocking_move_to_z(current_position.z + Z_CLEARANCE_BETWEEN_PROBES, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    return run_z_probe(sanity_check);
+  }
+
+  /**
+   * Stop scanning. Raise as if the last point had been probed with PROBE_PT_RAISE.
+   */
+  void Probe::scan_end() {
+    if (!isnan(scan_z))
+      do_blocking_move_to_z(current_position.z + Z_CLEARANCE_BETWEEN_PROBES, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    scanning = false;
+  }
+
+#endif // PROBE_FAST_SCAN
+
 /**
  * - Move to the given XY
  * - Deploy the probe, if not already deployed
@@ -690,14 +746,28 @@ float Probe::probe_at_point(const float &rx, const float &ry, const ProbePtRaise
   const float old_feedrate_mm_s = feedrate_mm_s;
   feedrate_mm_s = XY_PROBE_FEEDRATE_MM_S;
 
-  // Move the probe to the starting XYZ
-  do_blocking_move_to(npos);
-
   float measured_z = NAN;
-  if (!deploy()) measured_z = run_z_probe(sanity_check) + offset.z;
+
+  #if ENABLED(PROBE_FAST_SCAN)
+    // While scanning, stay low and go on from the last contact
+    const bool scan = scanning && raise_after == PROBE_PT_RAISE;
+    if (scan && !isnan(scan_z))
+      measured_z = scan_at_point(npos, sanity_check);
+    else
+  #endif
+  {
+    // Move the probe to the starting XYZ
+    do_blocking_move_to(npos);
+
+    if (!deploy()) measured_z = run_z_probe(sanity_check);
+  }
+
+  TERN_(PROBE_FAST_SCAN, if (scan) scan_z = measured_z);
+
   if (!isnan(measured_z)) {
+    measured_z += offset.z;
     const bool big_raise = raise_after == PROBE_PT_BIG_RAISE;
-    if (big_raise || raise_after == PROBE_PT_RAISE)
+    if (big_raise || (raise_after == PROBE_PT_RAISE && TERN1(PROBE_FAST_SCAN, !scan)))
       do_blocking_move_to_z(current_position.z + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES), MMM_TO_MMS(Z_PROBE_SPEED_FAST));
     else if (raise_after == PROBE_PT_STOW)
       if (stow()) measured_z = NAN;   // Error on stow?
@@ -719,6 +789,78 @@ float Probe::probe_at_point(const float &rx, const float &ry, const ProbePtRaise
   return measured_z;
 }
 
+/**
+ * Return the index of the nearest point to 'from' not yet probed
+ */
+static uint8_t nearest_unprobed(const xy_pos_t pos[], const uint8_t probed[], const uint8_t count, const xy_pos_t &from) {
+  uint8_t nearest = 0;
+  float best = INFINITY;
+  LOOP_L_N(i, count) {
+    if (TEST(probed[i >> 3], i & 7)) continue;
+    const float d = sq(pos[i].x - from.x) + sq(pos[i].y - from.y);
+    if (d < best) { nearest = i; best = d; }
+  }
+  return nearest;
+}
+
+/**
+ * @brief Probe a set of points in the order that needs the least travel.
+ *
+ * @details Starting from the current position, go on to the nearest point
+ *          not yet probed. Offsets cancel out between points, so the order
+ *          is the same for probe and nozzle positions. With PROBE_PT_RAISE
+ *          the raise after each point and the travel to the next one are
+ *          queued together, so there's only one wait for the planner.
+ *          The travel to each point after the first is no lower than
+ *          travel_z, for beds that may be far out of level.
+ *          With a progress message the status shows "<msg> n/count".
+ *
+ * @return The Z of the last point probed, where the probe is now,
+ *         or NAN if a point failed. A failed point's Z is NAN and
+ *         the Z of points not yet probed are left unchanged.
+ */
+float Probe::probe_points(const xy_pos_t pos[], float z[], const uint8_t count, const ProbePtRaise raise_after/*=PROBE_PT_RAISE*/, const uint8_t verbose_level/*=0*/, const bool probe_relative/*=true*/, const bool sanity_check/*=true*/, const float &travel_z/*=0*/, PGM_P const progress/*=nullptr*/) {
+  DEBUG_SECTION(log_probe, "Probe::probe_points", DEBUGGING(LEVELING));
+
+  #if HAS_DISPLAY
+    #define PROBE_PROGRESS(N) do{ if (progress) ui.status_printf_P(0, PSTR(S_FMT " %i/%i"), progress, int(N), int(count)); }while(0)
+  #else
+    #define PROBE_PROGRESS(N) UNUSED(progress)
+  #endif
+
+  uint8_t probed[32] = { 0 };
+
+  // Where the probe, or the nozzle, is now
+  xy_pos_t here = current_position;
+  if (probe_relative) here += offset_xy;
+
+  // While scanning, probe_at_point stays low between points by itself
+  const bool queue_raise = raise_after == PROBE_PT_RAISE && TERN1(PROBE_FAST_SCAN, !scanning);
+
+  uint8_t i = nearest_unprobed(pos, probed, count, here);
+  for (uint8_t left = count; left--;) {
+    PROBE_PROGRESS(count - left);
+    z[i] = probe_at_point(pos[i], left && queue_raise ? PROBE_PT_NONE : raise_after, verbose_level, probe_relative, sanity_check);
+    if (isnan(z[i]) || !left) break;
+
+    SBI(probed[i >> 3], i & 7);
+    i = nearest_unprobed(pos, probed, count, pos[i]);
+
+    // Raise and travel to the next point. An unreachable point fails in probe_at_point.
+    xy_pos_t npos = pos[i];
+    if (probe_relative) {
+      if (!can_reach(npos)) continue;
+      npos -= offset_xy;
+    }
+    else if (!position_is_reachable(npos)) continue;
+
+    const float rz = current_position.z + (queue_raise ? Z_CLEARANCE_BETWEEN_PROBES : 0);
+    do_blocking_move_to(npos.x, npos.y, _MAX(rz, travel_z));
+  }
+
+  return z[i];
+}
+
 #if HAS_Z_SERVO_PROBE
 
   void Probe::servo_probe_init() {
@@ -89,6 +89,16 @@ public:
       return probe_at_point(pos.x, pos.y, raise_after, verbose_level, probe_relative, sanity_check);
     }
 
+    // Probe up to 255 points in travel order, traveling no lower than travel_z. Results go in z[] in the given order.
+    // Return the Z of the last point probed, or NAN on failure.
+    static float probe_points(const xy_pos_t pos[], float z[], const uint8_t count, const ProbePtRaise raise_after=PROBE_PT_RAISE, const uint8_t verbose_level=0, const bool probe_relative=true, const bool sanity_check=true, const float &travel_z=0, PGM_P const progress=nullptr);
+
+    #if ENABLED(PROBE_FAST_SCAN)
+      // Points probed with PROBE_PT_RAISE between these are scanned, staying low
+      static inline void scan_start() { scanning = true; scan_z = NAN; }
+      static void scan_end();
+    #endif
+
   #else
 
     static constexpr xyz_pos_t offset = xyz_pos_t({ 0, 0, 0 }); // See #16767
@@ -220,6 +230,12 @@ private:
   static bool probe_down_to_z(const float z, const feedRate_t fr_mm_s);
   static void do_z_raise(const float z_raise);
   static float run_z_probe(const bool sanity_check=true);
+
+  #if ENABLED(PROBE_FAST_SCAN)
+    static bool scanning;
+    static float scan_z;  // Nozzle Z at the last contact, NAN before the first
+    static float scan_at_point(const xy_pos_t &npos, const bool sanity_check);
+  #endif
 };
 
 extern Probe probe;
@@ -36,7 +36,7 @@
  */
 
 // Change EEPROM version if the structure changes
-#define EEPROM_VERSION "V82"
+#define EEPROM_VERSION "V83"
 #define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
@@ -150,6 +150,10 @@
   #include "../lcd/tft/touch.h"
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+  #include "../feature/input_shaping.h"
+#endif
+
 #pragma pack(push, 1) // No padding between variables
 
 typedef struct { uint16_t X, Y, Z, X2, Y2, Z2, Z3, Z4, E0, E1, E2, E3, E4, E5, E6, E7; } tmc_stepper_current_t;
@@ -309,6 +313,13 @@ typedef struct SettingsDataStruct {
   //
   PID_t bedPID;                                         // M304 PID / M303 E-1 U
 
+  //
+  // MPCTEMP
+  //
+  #if ENABLED(MPCTEMP)
+    MPC_t mpc_constants[HOTENDS];                       // M306 En PCRAFH / M306 T
+  #endif
+
   //
   // User-defined Thermistors
   //
@@ -431,6 +442,21 @@ typedef struct SettingsDataStruct {
     touch_calibration_t touch_calibration;
   #endif
 
+  //
+  // INPUT_SHAPING
+  //
+  #if ENABLED(INPUT_SHAPING)
+    shaping_settings_t shaping_settings[XY];            // M593 X Y T F D
+  #endif
+
+  //
+  // ARC_CHORD_TOLERANCE
+  //
+  #ifdef ARC_CHORD_TOLERANCE
+    float arc_chord_tolerance;                          // M930 S
+    uint16_t arc_segment_time;                          // M930 T
+  #endif
+
 } SettingsData;
 
 //static_assert(sizeof(SettingsData) <= MARLIN_EEPROM_SIZE, "EEPROM too small to contain SettingsData!");
@@ -475,6 +501,7 @@ void MarlinSettings::postprocess() {
   TERN_(ENABLE_LEVELING_FADE_HEIGHT, set_z_fade_height(new_z_fade_height, false)); // false = no report
 
   TERN_(AUTO_BED_LEVELING_BILINEAR, refresh_bed_level());
+  TERN_(UBL_CELL_CACHE, ubl.refresh_cell_cache());
 
   TERN_(HAS_MOTOR_CURRENT_PWM, stepper.refresh_motor_power());
 
@@ -484,6 +511,8 @@ void MarlinSettings::postprocess() {
 
   TERN_(HAS_CASE_LIGHT_BRIGHTNESS, caselight.update_brightness());
 
+  TERN_(INPUT_SHAPING, input_shaping.refresh());
+
   // Refresh steps_to_mm with the reciprocal of axis_steps_per_mm
   // and init stepper.count[], planner.position[] with current_position
   planner.refresh_positioning();
@@ -899,6 +928,16 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(bed_pid);
     }
 
+    //
+    // MPCTEMP
+    //
+    #if ENABLED(MPCTEMP)
+    {
+      _FIELD_TEST(mpc_constants);
+      HOTEND_LOOP() EEPROM_WRITE(thermalManager.temp_hotend[e].constants);
+    }
+    #endif
+
     //
     // User-defined Thermistors
     //
@@ -1383,6 +1422,21 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(touch.calibration);
     #endif
 
+    //
+    // Input Shaping
+    //
+    #if ENABLED(INPUT_SHAPING)
+      EEPROM_WRITE(input_shaping.settings);
+    #endif
+
+    //
+    // Arc chord tolerance
+    //
+    #ifdef ARC_CHORD_TOLERANCE
+      EEPROM_WRITE(gcode.arc_chord_tolerance);
+      EEPROM_WRITE(gcode.arc_segment_time);
+    #endif
+
     //
     // Validate CRC and Data Size
     //
@@ -1778,6 +1832,20 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      //
+      // Hotend Model Predictive Control
+      //
+      #if ENABLED(MPCTEMP)
+      {
+        _FIELD_TEST(mpc_constants);
+        HOTEND_LOOP() {
+          MPC_t mpc;
+          EEPROM_READ(mpc);
+          if (!validating) thermalManager.temp_hotend[e].constants = mpc;
+        }
+      }
+      #endif
+
       //
       // User-defined Thermistors
       //
@@ -1785,6 +1853,9 @@ void MarlinSettings::postprocess() {
       {
         _FIELD_TEST(user_thermistor);
         EEPROM_READ(thermalManager.user_thermistor);
+        #if ENABLED(THERMISTOR_LUT)
+          LOOP_L_N(i, USER_THERMISTORS) thermalManager.user_thermistor[i].pre_calc = true; // Rebuild the lookup tables
+        #endif
       }
       #endif
 
@@ -2241,6 +2312,23 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(touch.calibration);
       #endif
 
+      //
+      // Input Shaping
+      //
+      #if ENABLED(INPUT_SHAPING)
+        _FIELD_TEST(shaping_settings);
+        EEPROM_READ(input_shaping.settings);
+      #endif
+
+      //
+      // Arc chord tolerance
+      //
+      #ifdef ARC_CHORD_TOLERANCE
+        _FIELD_TEST(arc_chord_tolerance);
+        EEPROM_READ(gcode.arc_chord_tolerance);
+        EEPROM_READ(gcode.arc_segment_time);
+      #endif
+
       eeprom_error = size_error(eeprom_index - (EEPROM_OFFSET));
       if (eeprom_error) {
         DEBUG_ECHO_START();
@@ -2417,6 +2505,10 @@ void MarlinSettings::postprocess() {
         if (status) SERIAL_ECHOLNPGM("?Unable to load mesh data.");
         else        DEBUG_ECHOLNPAIR("Mesh loaded from slot ", slot);
 
+        #if ENABLED(UBL_CELL_CACHE)
+          if (!into) ubl.refresh_cell_cache();
+        #endif
+
         EEPROM_FINISH();
 
       #else
@@ -2548,6 +2640,19 @@ void MarlinSettings::reset() {
   //
   TERN_(TOUCH_SCREEN_CALIBRATION, touch.calibration_reset());
 
+  //
+  // Input Shaping
+  //
+  TERN_(INPUT_SHAPING, input_shaping.reset());
+
+  //
+  // Arc chord tolerance
+  //
+  #ifdef ARC_CHORD_TOLERANCE
+    gcode.arc_chord_tolerance = ARC_CHORD_TOLERANCE;
+    gcode.arc_segment_time = ARC_SEGMENT_MIN_TIME;
+  #endif
+
   //
   // Magnetic Parking Extruder
   //
@@ -2736,6 +2841,34 @@ void MarlinSettings::reset() {
     thermalManager.temp_bed.pid.Kd = scalePID_d(DEFAULT_bedKd);
   #endif
 
+  //
+  // Hotend Model Predictive Control
+  //
+
+  #if ENABLED(MPCTEMP)
+    constexpr float _mpc_heater_power[] = MPC_HEATER_POWER,
+                    _mpc_block_heat_capacity[] = MPC_BLOCK_HEAT_CAPACITY,
+                    _mpc_sensor_responsiveness[] = MPC_SENSOR_RESPONSIVENESS,
+                    _mpc_ambient_xfer_coeff[] = MPC_AMBIENT_XFER_COEFF,
+                    _mpc_ambient_xfer_coeff_fan255[] = MPC_AMBIENT_XFER_COEFF_FAN255,
+                    _filament_heat_capacity_permm[] = FILAMENT_HEAT_CAPACITY_PERMM;
+    static_assert(COUNT(_mpc_heater_power) == HOTENDS, "MPC_HEATER_POWER must have HOTENDS items.");
+    static_assert(COUNT(_mpc_block_heat_capacity) == HOTENDS, "MPC_BLOCK_HEAT_CAPACITY must have HOTENDS items.");
+    static_assert(COUNT(_mpc_sensor_responsiveness) == HOTENDS, "MPC_SENSOR_RESPONSIVENESS must have HOTENDS items.");
+    static_assert(COUNT(_mpc_ambient_xfer_coeff) == HOTENDS, "MPC_AMBIENT_XFER_COEFF must have HOTENDS items.");
+    static_assert(COUNT(_mpc_ambient_xfer_coeff_fan255) == HOTENDS, "MPC_AMBIENT_XFER_COEFF_FAN255 must have HOTENDS items.");
+    static_assert(COUNT(_filament_heat_capacity_permm) == HOTENDS, "FILAMENT_HEAT_CAPACITY_PERMM must have HOTENDS items.");
+    HOTEND_LOOP() {
+      MPC_t &constants = thermalManager.temp_hotend[e].constants;
+      constants.heater_power = _mpc_heater_power[e];
+      constants.block_heat_capacity = _mpc_block_heat_capacity[e];
+      constants.sensor_responsiveness = _mpc_sensor_responsiveness[e];
+      constants.ambient_xfer_coeff_fan0 = _mpc_ambient_xfer_coeff[e];
+      constants.fan255_adjustment = _mpc_ambient_xfer_coeff_fan255[e] - _mpc_ambient_xfer_coeff[e];
+      constants.filament_heat_capacity_permm = _filament_heat_capacity_permm[e];
+    }
+  #endif
+
   //
   // User-Defined Thermistors
   //
@@ -3317,6 +3450,21 @@ void MarlinSettings::reset() {
 
     #endif // PIDTEMP || PIDTEMPBED
 
+    #if ENABLED(MPCTEMP)
+      CONFIG_ECHO_HEADING("Model predictive control:");
+      HOTEND_LOOP() {
+        const MPC_t &constants = thermalManager.temp_hotend[e].constants;
+        CONFIG_ECHO_START();
+        SERIAL_ECHOPAIR("  M306 E", e);
+        SERIAL_ECHOPAIR_F(" P", constants.heater_power, 2);
+        SERIAL_ECHOPAIR_F(" C", constants.block_heat_capacity, 2);
+        SERIAL_ECHOPAIR_F(" R", constants.sensor_responsiveness, 4);
+        SERIAL_ECHOPAIR_F(" A", constants.ambient_xfer_coeff_fan0, 4);
+        SERIAL_ECHOPAIR_F(" F", constants.ambient_xfer_coeff_fan0 + constants.fan255_adjustment, 4);
+        SERIAL_ECHOLNPAIR_F(" H", constants.filament_heat_capacity_permm, 6);
+      }
+    #endif
+
     #if HAS_USER_THERMISTORS
       CONFIG_ECHO_HEADING("User thermistors:");
       LOOP_L_N(i, USER_THERMISTORS)
@@ -3715,6 +3863,23 @@ void MarlinSettings::reset() {
       #endif
     #endif
 
+    /**
+     * Input Shaping
+     */
+    #if ENABLED(INPUT_SHAPING)
+      CONFIG_ECHO_HEADING("Input Shaping:");
+      CONFIG_ECHO_START();
+      SERIAL_ECHOLNPAIR("  M593 X T", int(input_shaping.settings[X_AXIS].type), " F", input_shaping.settings[X_AXIS].frequency, " D", input_shaping.settings[X_AXIS].zeta);
+      CONFIG_ECHO_START();
+      SERIAL_ECHOLNPAIR("  M593 Y T", int(input_shaping.settings[Y_AXIS].type), " F", input_shaping.settings[Y_AXIS].frequency, " D", input_shaping.settings[Y_AXIS].zeta);
+    #endif
+
+    #ifdef ARC_CHORD_TOLERANCE
+      CONFIG_ECHO_HEADING("Arc segmentation:");
+      CONFIG_ECHO_START();
+      SERIAL_ECHOLNPAIR("  M930 S", LINEAR_UNIT(gcode.arc_chord_tolerance), " T", gcode.arc_segment_time);
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       CONFIG_ECHO_HEADING("Stepper motor currents:");
       CONFIG_ECHO_START();
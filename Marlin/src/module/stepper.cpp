@@ -102,6 +102,10 @@ Stepper stepper; // Singleton
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(MOTION_BENCHMARK)
+  #include "../feature/benchmark.h"
+#endif
+
 #if MB(ALLIGATOR)
   #include "../feature/dac/dac_dac084s085.h"
 #endif
@@ -227,6 +231,14 @@ uint32_t Stepper::advance_divisor = 0,
   uint32_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+  uint32_t Stepper::nextShapingISR = StepShaper::NEVER,
+           Stepper::shaping_ticks;
+  int8_t Stepper::shaping_dir[XY];
+  StepShaper Stepper::shaper[XY];
+  bool Stepper::shaping_bypass;
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   page_step_state_t Stepper::page_step_state;
 #endif
@@ -468,11 +480,17 @@ void Stepper::set_directions() {
       count_direction[_AXIS(A)] = 1;            \
     }
 
-  #if HAS_X_DIR
-    SET_STEP_DIR(X); // A
-  #endif
-  #if HAS_Y_DIR
-    SET_STEP_DIR(Y); // B
+  #if ENABLED(INPUT_SHAPING)
+    // The shapers set the X and Y DIR pins when they step
+    count_direction.x = motor_direction(X_AXIS) ? -1 : 1;
+    count_direction.y = motor_direction(Y_AXIS) ? -1 : 1;
+  #else
+    #if HAS_X_DIR
+      SET_STEP_DIR(X); // A
+    #endif
+    #if HAS_Y_DIR
+      SET_STEP_DIR(Y); // B
+    #endif
   #endif
   #if HAS_Z_DIR
     SET_STEP_DIR(Z); // C
@@ -1353,6 +1371,8 @@ HAL_STEP_TIMER_ISR() {
 
 void Stepper::isr() {
 
+  TERN_(MOTION_BENCHMARK, BENCHMARK_SCOPE(STEPPER_ISR));
+
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
   #ifndef __AVR__
@@ -1384,6 +1404,10 @@ void Stepper::isr() {
       if (!nextAdvanceISR) nextAdvanceISR = advance_isr();          // 0 = Do Linear Advance E Stepper pulses
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      if (!nextShapingISR) nextShapingISR = shaping_isr();          // 0 = Do delayed X/Y Input Shaping pulses
+    #endif
+
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       const bool is_babystep = (nextBabystepISR == 0);              // 0 = Do Babystepping (XY)Z pulses
       if (is_babystep) nextBabystepISR = babystepping_isr();
@@ -1410,6 +1434,9 @@ void Stepper::isr() {
       #if ENABLED(INTEGRATED_BABYSTEPPING)
         , nextBabystepISR                               // Come back early for Babystepping?
       #endif
+      #if ENABLED(INPUT_SHAPING)
+        , nextShapingISR                                // Come back early for Input Shaping?
+      #endif
       , uint32_t(HAL_TIMER_TYPE_MAX)                    // Come back in a very long time
     );
 
@@ -1430,6 +1457,11 @@ void Stepper::isr() {
       if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval;
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      if (nextShapingISR != StepShaper::NEVER) nextShapingISR -= interval;
+      shaping_ticks += interval;
+    #endif
+
     /**
      * This needs to avoid a race-condition caused by interleaving
      * of interrupts required by both the LA and Stepper algorithms.
@@ -1509,6 +1541,18 @@ void Stepper::isr() {
   #define ISR_MULTI_STEPS 1
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+  // Point the DIR pin of a shaped axis the way of the step about to be taken
+  #define SHAPING_APPLY_DIR(AXIS, D) do{ \
+    if ((D) != shaping_dir[_AXIS(AXIS)]) { \
+      DIR_WAIT_BEFORE(); \
+      AXIS##_APPLY_DIR((D) > 0 ? !INVERT_##AXIS##_DIR : INVERT_##AXIS##_DIR, false); \
+      shaping_dir[_AXIS(AXIS)] = (D); \
+      DIR_WAIT_AFTER(); \
+    } \
+  }while(0)
+#endif
+
 /**
  * This phase of the ISR should ONLY create the pulses for the steppers.
  * This prevents jitter caused by the interval between the start of the
@@ -1518,6 +1562,8 @@ void Stepper::isr() {
  */
 void Stepper::pulse_phase_isr() {
 
+  TERN_(MOTION_BENCHMARK, BENCHMARK_SCOPE(PULSE_PHASE));
+
   // If we must abort the current block, do so!
   if (abort_current_block) {
     abort_current_block = false;
@@ -1708,6 +1754,28 @@ void Stepper::pulse_phase_isr() {
       #endif
     }
 
+    #if ENABLED(INPUT_SHAPING)
+      // Feed X and Y steps to the shapers and take the part that is due now
+      #define SHAPING_PREP(AXIS) do{ \
+        StepShaper &s = shaper[_AXIS(AXIS)]; \
+        if (step_needed[_AXIS(AXIS)]) { \
+          if (shaping_bypass) \
+            s.push_unshaped(count_direction[_AXIS(AXIS)]); \
+          else { \
+            s.push(shaping_ticks, count_direction[_AXIS(AXIS)]); \
+            NOMORE(nextShapingISR, s.first_delay()); \
+          } \
+        } \
+        const int8_t d = s.step_due(); \
+        step_needed[_AXIS(AXIS)] = d != 0; \
+        if (d) SHAPING_APPLY_DIR(AXIS, d); \
+        if (s.step_pending()) nextShapingISR = 0; /* The shaping ISR takes the rest */ \
+      }while(0)
+
+      SHAPING_PREP(X);
+      SHAPING_PREP(Y);
+    #endif
+
     #if ISR_MULTI_STEPS
       if (firstStep)
         firstStep = false;
@@ -1779,6 +1847,8 @@ void Stepper::pulse_phase_isr() {
 
 uint32_t Stepper::block_phase_isr() {
 
+  TERN_(MOTION_BENCHMARK, BENCHMARK_SCOPE(BLOCK_PHASE));
+
   // If no queued movements, just wait 1ms for the next block
   uint32_t interval = (STEPPER_TIMER_RATE) / 1000UL;
 
@@ -1995,6 +2065,9 @@ uint32_t Stepper::block_phase_isr() {
           return interval; // No more queued movements!
       }
 
+      TERN_(MOTION_BENCHMARK, motion_benchmark.blocks_executed++);
+      TERN_(EVENT_TRACE, event_trace.record(TRACE_BLOCK_START, planner.movesplanned()));
+
       // For non-inline cutter, grossly apply power
       #if ENABLED(LASER_FEATURE) && DISABLED(LASER_POWER_INLINE)
         cutter.apply_power(current_block->cutter_power);
@@ -2344,6 +2417,61 @@ uint32_t Stepper::block_phase_isr() {
 
 #endif // LIN_ADVANCE
 
+#if ENABLED(INPUT_SHAPING)
+
+  // Timer interrupt for the delayed X and Y steps of the input shapers
+  uint32_t Stepper::shaping_isr() {
+    const uint32_t interval = _MIN(shaper[X_AXIS].replay(shaping_ticks), shaper[Y_AXIS].replay(shaping_ticks));
+
+    #if ISR_MULTI_STEPS
+      bool firstStep = true;
+      USING_TIMED_PULSE();
+    #endif
+
+    for (;;) {
+      const int8_t dx = shaper[X_AXIS].step_due(), dy = shaper[Y_AXIS].step_due();
+      if (!dx && !dy) break;
+
+      if (dx) SHAPING_APPLY_DIR(X, dx);
+      if (dy) SHAPING_APPLY_DIR(Y, dy);
+
+      #if ISR_MULTI_STEPS
+        if (firstStep)
+          firstStep = false;
+        else
+          AWAIT_LOW_PULSE();
+      #endif
+
+      // Set the STEP pulse ON
+      if (dx) X_APPLY_STEP(!INVERT_X_STEP_PIN, 0);
+      if (dy) Y_APPLY_STEP(!INVERT_Y_STEP_PIN, 0);
+
+      // Enforce a minimum duration for STEP pulse ON
+      #if ISR_PULSE_CONTROL
+        START_HIGH_PULSE();
+        AWAIT_HIGH_PULSE();
+      #endif
+
+      // Set the STEP pulse OFF
+      if (dx) X_APPLY_STEP(INVERT_X_STEP_PIN, 0);
+      if (dy) Y_APPLY_STEP(INVERT_Y_STEP_PIN, 0);
+
+      #if ISR_PULSE_CONTROL
+        START_LOW_PULSE();
+      #endif
+    }
+
+    return interval;
+  }
+
+  void Stepper::set_shaping(const AxisEnum axis, const shaping_settings_t &s) {
+    const bool was_enabled = suspend();
+    shaper[axis].set(s);
+    if (was_enabled) wake_up();
+  }
+
+#endif // INPUT_SHAPING
+
 #if ENABLED(INTEGRATED_BABYSTEPPING)
 
   // Timer interrupt for baby-stepping
@@ -48,6 +48,9 @@
 #ifdef __AVR__
   #include "speed_lookuptable.h"
 #endif
+#if ENABLED(INPUT_SHAPING)
+  #include "../feature/input_shaping.h"
+#endif
 
 // Disable multiple steps per ISR
 //#define DISABLE_MULTI_STEPPING
@@ -341,6 +344,12 @@ class Stepper {
       static uint32_t nextBabystepISR;
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      static uint32_t nextShapingISR,
+                      shaping_ticks;    // Stepper timer ticks elapsed, to time the delayed steps
+      static int8_t shaping_dir[XY];    // Direction last applied to the X and Y DIR pins (0 = unknown)
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static page_step_state_t page_step_state;
     #endif
@@ -411,6 +420,19 @@ class Stepper {
       FORCE_INLINE static void initiateLA() { nextAdvanceISR = 0; }
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      static StepShaper shaper[XY];
+      static bool shaping_bypass;       // Don't shape new X and Y steps (e.g., while homing)
+
+      // The Input Shaping ISR phase
+      static uint32_t shaping_isr();
+
+      // Set up the shaper of an axis. Its delayed steps must have been replayed.
+      static void set_shaping(const AxisEnum axis, const shaping_settings_t &s);
+
+      FORCE_INLINE static bool shaping_busy() { return shaper[X_AXIS].busy() || shaper[Y_AXIS].busy(); }
+    #endif
+
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       // The Babystepping ISR phase
       static uint32_t babystepping_isr();
@@ -73,7 +73,7 @@
   #include "../libs/private_spi.h"
 #endif
 
-#if ENABLED(PID_EXTRUSION_SCALING)
+#if EITHER(PID_EXTRUSION_SCALING, MPCTEMP)
   #include "stepper.h"
 #endif
 
@@ -126,6 +126,42 @@
   #endif
 #endif
 
+#if ENABLED(THERMISTOR_LUT)
+
+  #define THERMISTOR_LUT_SIZE _BV(THERMISTOR_LUT_BITS)
+  #define THERMISTOR_LUT_STEP ((MAX_RAW_THERMISTOR_VALUE + 1) / (THERMISTOR_LUT_SIZE)) // Raw values per entry
+
+  // First table entry at or over the lowest raw value of each step
+  #if HOTEND_USES_THERMISTOR
+    static uint8_t heater_ttbl_index[COUNT(heater_ttbl_map)][THERMISTOR_LUT_SIZE];
+  #endif
+  #if ENABLED(HEATER_BED_USES_THERMISTOR) && DISABLED(HEATER_BED_USER_THERMISTOR)
+    static uint8_t bed_ttbl_index[THERMISTOR_LUT_SIZE];
+  #endif
+  #if ENABLED(HEATER_CHAMBER_USES_THERMISTOR) && DISABLED(HEATER_CHAMBER_USER_THERMISTOR)
+    static uint8_t chamber_ttbl_index[THERMISTOR_LUT_SIZE];
+  #endif
+  #if ENABLED(PROBE_USES_THERMISTOR) && DISABLED(PROBE_USER_THERMISTOR)
+    static uint8_t probe_ttbl_index[THERMISTOR_LUT_SIZE];
+  #endif
+
+  // Custom thermistor temperatures (1/16 °C) at the start of each step
+  #if HAS_USER_THERMISTORS
+    static int16_t user_thermistor_lut[USER_THERMISTORS][(THERMISTOR_LUT_SIZE) + 1];
+  #endif
+
+  static void thermistor_index_init(uint8_t index[], const temp_entry_t *tbl, const uint8_t len) {
+    if (len < 2) return;
+    uint8_t j = 1;
+    for (uint16_t i = 0; i < THERMISTOR_LUT_SIZE; i++) {
+      const int16_t r = i * (THERMISTOR_LUT_STEP);
+      while (j < len - 1 && int16_t(pgm_read_word(&tbl[j].value)) < r) j++;
+      index[i] = j;
+    }
+  }
+
+#endif // THERMISTOR_LUT
+
 Temperature thermalManager;
 
 const char str_t_thermal_runaway[] PROGMEM = STR_T_THERMAL_RUNAWAY,
@@ -324,6 +360,10 @@ volatile bool Temperature::raw_temps_ready = false;
   lpq_ptr_t Temperature::lpq_ptr = 0;
 #endif
 
+#if ENABLED(MPCTEMP)
+  int32_t Temperature::mpc_e_position; // = 0
+#endif
+
 #define TEMPDIR(N) ((HEATER_##N##_RAW_LO_TEMP) < (HEATER_##N##_RAW_HI_TEMP) ? 1 : -1)
 
 #if HAS_HOTEND
@@ -659,6 +699,222 @@ volatile bool Temperature::raw_temps_ready = false;
 
 #endif // HAS_PID_HEATING
 
+#if ENABLED(MPCTEMP)
+
+  /**
+   * MPC Autotuning (M306 T)
+   *
+   * Identify the thermal model of a hotend in three steps:
+   *  - Cool with the part fan on full until the temperature levels off at ambient.
+   *  - Heat at full power to the tuning temperature. Three points on the rise fix
+   *    the exponential approach to the asymptote, giving the block's heat capacity
+   *    and the sensor's lag.
+   *  - Hold the temperature with the new model, first with the fan off and then on
+   *    full, and measure the power needed to offset the heat lost to the room.
+   */
+  void Temperature::MPC_autotune(const uint8_t e) {
+    hotend_info_t &hotend = temp_hotend[e];
+    MPC_t &constants = hotend.constants;
+
+    constexpr float target = MPC_TUNING_TEMP;
+    constexpr millis_t settle_time = 20000UL, test_duration = 20000UL;
+
+    if (target > temp_range[e].maxtemp - (HOTEND_OVERSHOOT)) {
+      SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
+      return;
+    }
+
+    millis_t ms = millis(), next_report_ms = ms, next_test_ms = ms + 10000UL;
+    float current_temp = degHotend(e), ambient_temp = current_temp;
+    bool sampled = false;
+
+    float temp_samples[16];
+    uint8_t sample_count = 0;
+    uint16_t sample_distance = 1;   // (s) Grows as samples are thinned out
+    float t1_time = 0;              // (s) Time from the start of heating to the first sample
+    millis_t heat_start_ms, next_sample_ms;
+
+    float t1, t2, t3, asymp_temp, block_responsiveness;
+    float last_temp, total_energy_fan0 = 0, total_energy_fan255 = 0;
+    uint16_t fan0_samples = 0, fan255_samples = 0;
+    millis_t settle_end_ms, test_end_ms;
+    bool fan0_done = false;
+
+    // Wait for a sample, run the UI and report. Return false to abort.
+    auto housekeeping = [&]() -> bool {
+      ms = millis();
+      sampled = raw_temps_ready;
+      if (sampled) {
+        updateTemperaturesFromRawValues();
+        current_temp = degHotend(e);
+        if (current_temp > temp_range[e].maxtemp) max_temp_error((heater_id_t)e);
+        #if HAS_AUTO_FAN
+          if (ELAPSED(ms, next_auto_fan_check_ms)) {
+            checkExtruderAutoFans();
+            next_auto_fan_check_ms = ms + 2500UL;
+          }
+        #endif
+      }
+      if (ELAPSED(ms, next_report_ms)) {
+        next_report_ms = ms + 1000UL;
+        print_heater_states(e);
+        SERIAL_EOL();
+      }
+      TERN_(HAL_IDLETASK, HAL_idletask());
+      TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+      if (!wait_for_heatup) SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_INTERRUPTED);
+      return wait_for_heatup;
+    };
+
+    SERIAL_ECHOLNPAIR(STR_MPC_AUTOTUNE_START, int(e));
+
+    disable_all_heaters();
+    TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
+    #if HAS_FAN
+      const uint8_t old_fan_speed = fan_speed[0];
+      set_fan_speed(0, 255);
+      planner.check_axes_activity();
+    #endif
+
+    // Cool down until the temperature stops falling
+    SERIAL_ECHOLNPGM(STR_MPC_COOLING_TO_AMBIENT);
+    wait_for_heatup = true; // Can be interrupted with M108
+    for (;;) {
+      if (!housekeeping()) goto EXIT_M306;
+      if (ELAPSED(ms, next_test_ms)) {
+        if (current_temp >= ambient_temp) {
+          ambient_temp = (ambient_temp + current_temp) / 2;
+          break;
+        }
+        ambient_temp = current_temp;
+        next_test_ms += 10000UL;
+      }
+    }
+
+    #if HAS_FAN
+      set_fan_speed(0, 0);
+      planner.check_axes_activity();
+    #endif
+
+    // Heat at full power, sampling from a third of the way up
+    SERIAL_ECHOLNPAIR(STR_MPC_HEATING_TO, target);
+    hotend.target = target;   // So M105 looks nice
+    hotend.soft_pwm_amount = (MPC_MAX) >> 1;
+    heat_start_ms = next_sample_ms = ms;
+    for (;;) {
+      if (!housekeeping()) goto EXIT_M306;
+      if (ELAPSED(ms, next_sample_ms)) {
+        next_sample_ms += SEC_TO_MS(sample_distance);
+        if (current_temp >= ambient_temp + (target - ambient_temp) / 3) {
+          if (sample_count == 0) t1_time = (ms - heat_start_ms) * 0.001f;
+          temp_samples[sample_count++] = current_temp;
+          if (sample_count == COUNT(temp_samples)) {
+            // Keep every other sample. The next one is already due on the wider grid.
+            for (uint8_t i = 0; i < COUNT(temp_samples) / 2; i++) temp_samples[i] = temp_samples[i * 2];
+            sample_count /= 2;
+            sample_distance *= 2;
+          }
+        }
+        if (current_temp >= target) break;
+      }
+      if (ELAPSED(ms, heat_start_ms + SEC_TO_MS(600))) {
+        SERIAL_ECHOLNPGM(STR_MPC_TEMPERATURE_ERROR);
+        goto EXIT_M306;
+      }
+    }
+    hotend.soft_pwm_amount = 0;
+
+    // Fit the exponential rise through three equally spaced samples
+    if (sample_count < 3) {
+      SERIAL_ECHOLNPGM(STR_MPC_TEMPERATURE_ERROR);
+      goto EXIT_M306;
+    }
+    sample_count -= !(sample_count & 1);
+    t1 = temp_samples[0];
+    t2 = temp_samples[sample_count >> 1];
+    t3 = temp_samples[sample_count - 1];
+    asymp_temp = (sq(t2) - t1 * t3) / (2 * t2 - t1 - t3);
+    block_responsiveness = -log((t2 - asymp_temp) / (t1 - asymp_temp)) / (sample_distance * (sample_count >> 1));
+
+    constants.ambient_xfer_coeff_fan0 = constants.heater_power * (MPC_MAX) / 255 / (asymp_temp - ambient_temp);
+    constants.fan255_adjustment = 0;
+    constants.block_heat_capacity = constants.ambient_xfer_coeff_fan0 / block_responsiveness;
+    constants.sensor_responsiveness = block_responsiveness / (1 - (ambient_temp - asymp_temp) * exp(-block_responsiveness * t1_time) / (t1 - asymp_temp));
+
+    // Start the model where the fit says the block is now
+    hotend.modeled_ambient_temp = ambient_temp;
+    hotend.modeled_block_temp = asymp_temp + (ambient_temp - asymp_temp) * exp(-block_responsiveness * (ms - heat_start_ms) * 0.001f);
+    hotend.modeled_sensor_temp = current_temp;
+
+    // Hold the block temperature and measure the power it takes
+    hotend.target = hotend.modeled_block_temp;
+    SERIAL_ECHOLNPAIR(STR_MPC_MEASURING_AMBIENT, hotend.modeled_block_temp);
+    last_temp = current_temp;
+    settle_end_ms = ms + settle_time;
+    test_end_ms = settle_end_ms + test_duration;
+    for (;;) {
+      if (!housekeeping()) goto EXIT_M306;
+      if (!sampled) continue;
+
+      hotend.soft_pwm_amount = (int)get_pid_output_hotend(e) >> 1;
+
+      // Energy into the heater, less any change in the heat stored in the block
+      if (ELAPSED(ms, settle_end_ms)) {
+        const float energy = constants.heater_power * hotend.soft_pwm_amount / 127 * MPC_dT + (last_temp - current_temp) * constants.block_heat_capacity;
+        if (fan0_done) { total_energy_fan255 += energy; fan255_samples++; }
+        else           { total_energy_fan0   += energy; fan0_samples++;   }
+      }
+      last_temp = current_temp;
+
+      if (ELAPSED(ms, test_end_ms)) {
+        #if HAS_FAN
+          if (!fan0_done) {
+            fan0_done = true;
+            set_fan_speed(0, 255);
+            planner.check_axes_activity();
+            settle_end_ms = ms + settle_time;
+            test_end_ms = settle_end_ms + test_duration;
+            continue;
+          }
+        #endif
+        break;
+      }
+
+      if (!WITHIN(current_temp, t3 - 15.0f, hotend.target + 15.0f)) {
+        SERIAL_ECHOLNPGM(STR_MPC_TEMPERATURE_ERROR);
+        goto EXIT_M306;
+      }
+    }
+
+    // Derive the losses from the power measured, then refit the rise to match
+    constants.ambient_xfer_coeff_fan0 = total_energy_fan0 / (fan0_samples * MPC_dT) / (hotend.target - ambient_temp);
+    #if HAS_FAN
+      constants.fan255_adjustment = total_energy_fan255 / (fan255_samples * MPC_dT) / (hotend.target - ambient_temp) - constants.ambient_xfer_coeff_fan0;
+    #endif
+    asymp_temp = ambient_temp + constants.heater_power * (MPC_MAX) / 255 / constants.ambient_xfer_coeff_fan0;
+    block_responsiveness = -log((t2 - asymp_temp) / (t1 - asymp_temp)) / (sample_distance * (sample_count >> 1));
+    constants.block_heat_capacity = constants.ambient_xfer_coeff_fan0 / block_responsiveness;
+    constants.sensor_responsiveness = block_responsiveness / (1 - (ambient_temp - asymp_temp) * exp(-block_responsiveness * t1_time) / (t1 - asymp_temp));
+
+    SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_FINISHED);
+    SERIAL_ECHOLNPAIR_F("MPC_BLOCK_HEAT_CAPACITY ", constants.block_heat_capacity, 4);
+    SERIAL_ECHOLNPAIR_F("MPC_SENSOR_RESPONSIVENESS ", constants.sensor_responsiveness, 4);
+    SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF ", constants.ambient_xfer_coeff_fan0, 4);
+    TERN_(HAS_FAN, SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF_FAN255 ", constants.ambient_xfer_coeff_fan0 + constants.fan255_adjustment, 4));
+
+    EXIT_M306:
+      wait_for_heatup = false;
+      hotend.target = 0;
+      hotend.soft_pwm_amount = 0;
+      hotend.modeled_block_temp = NAN; // Reseed the model from the sensor
+      #if HAS_FAN
+        set_fan_speed(0, old_fan_speed);
+        planner.check_axes_activity();
+      #endif
+  }
+
+#endif // MPCTEMP
+
 /**
  * Class and Instance Methods
  */
@@ -940,6 +1196,79 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         }
       #endif // PID_DEBUG
 
+    #elif ENABLED(MPCTEMP)
+
+      hotend_info_t &hotend = temp_hotend[ee];
+      const MPC_t &constants = hotend.constants;
+
+      // Seed the model from the sensor the first time through
+      if (isnan(hotend.modeled_block_temp)) {
+        hotend.modeled_ambient_temp = _MIN(30.0f, hotend.celsius); // Room temperature is rarely above 30°C
+        hotend.modeled_block_temp = hotend.modeled_sensor_temp = hotend.celsius;
+      }
+
+      #if HOTENDS == 1
+        constexpr bool this_hotend = true;
+      #else
+        const bool this_hotend = (ee == active_extruder);
+      #endif
+
+      // Heat lost to the room, to the part fan (blowing on the active hotend) and to filament
+      float ambient_xfer_coeff = constants.ambient_xfer_coeff_fan0, planned_xfer_coeff;
+      #if HAS_FAN
+        if (this_hotend) ambient_xfer_coeff += fan_speed[0] * (1.0f / 255) * constants.fan255_adjustment;
+      #endif
+      planned_xfer_coeff = ambient_xfer_coeff;
+
+      if (this_hotend) {
+        // Filament being pushed through right now cools the modeled block...
+        const int32_t e_position = stepper.position(E_AXIS);
+        const float e_speed = (e_position - mpc_e_position) * planner.steps_to_mm[E_AXIS_N(ee)] / MPC_dT;
+        if (e_speed > planner.settings.max_feedrate_mm_s[E_AXIS_N(ee)]) // A jump from G92 or a tool change
+          mpc_e_position = e_position;
+        else if (e_speed > 0) {                                         // Ignore retractions
+          ambient_xfer_coeff += e_speed * constants.filament_heat_capacity_permm;
+          mpc_e_position = e_position;
+        }
+        // ...and filament waiting in the planner queue is heated for ahead of time
+        planned_xfer_coeff += planner.planned_extrusion_speed(ee, MPC_FEED_FORWARD_TIME) * constants.filament_heat_capacity_permm;
+      }
+
+      // Advance the model by one sample period
+      const float blocktempdelta = (hotend.soft_pwm_amount * constants.heater_power * (1.0f / 127)
+                                    + (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff
+                                   ) * MPC_dT / constants.block_heat_capacity;
+      hotend.modeled_block_temp += blocktempdelta;
+      hotend.modeled_sensor_temp += (hotend.modeled_block_temp - hotend.modeled_sensor_temp) * (constants.sensor_responsiveness * MPC_dT);
+
+      // Pull the model toward the reading. Noise averages out and slow model error is absorbed.
+      const float delta_to_apply = (hotend.celsius - hotend.modeled_sensor_temp) * (MPC_SMOOTHING_FACTOR);
+      hotend.modeled_block_temp += delta_to_apply;
+      hotend.modeled_sensor_temp += delta_to_apply;
+
+      // Blame the remaining error on the ambient estimate, but only near steady state
+      if (WITHIN(hotend.soft_pwm_amount, 1, 126) || ABS(blocktempdelta + delta_to_apply) < (MPC_STEADYSTATE) * MPC_dT)
+        hotend.modeled_ambient_temp += delta_to_apply > 0 ? _MAX(delta_to_apply, (MPC_MIN_AMBIENT_CHANGE) * MPC_dT)
+                                                          : _MIN(delta_to_apply, -(MPC_MIN_AMBIENT_CHANGE) * MPC_dT);
+
+      float power = 0;
+      if (hotend.target && !TERN0(HEATER_IDLE_HANDLER, heater_idle[ee].timed_out)) {
+        // Power to bring the block to target in 2 seconds, plus the planned losses at that temperature
+        power = (hotend.target - hotend.modeled_block_temp) * constants.block_heat_capacity / 2
+              - (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * planned_xfer_coeff;
+      }
+
+      // Scale to 0..254 so soft_pwm_amount (output >> 1) rounds to the nearest of 0..127
+      const float pid_output = constrain(power * 254 / constants.heater_power + 1, 0, MPC_MAX);
+
+      #if ENABLED(PID_DEBUG)
+        if (ee == active_extruder && pid_debug_flag) {
+          SERIAL_ECHO_START();
+          SERIAL_ECHOLNPAIR(" MPC_DEBUG ", ee, STR_PID_DEBUG_INPUT, hotend.celsius, STR_PID_DEBUG_OUTPUT, pid_output,
+                            " Block ", hotend.modeled_block_temp, " Ambient ", hotend.modeled_ambient_temp);
+        }
+      #endif
+
     #else // No PID enabled
 
       const bool is_idling = TERN0(HEATER_IDLE_HANDLER, heater_idle[ee].timed_out);
@@ -1302,11 +1631,34 @@ void Temperature::manage_heater() {
 #define TEMP_AD595(RAW)  ((RAW) * 5.0 * 100.0 / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD595_GAIN) + TEMP_SENSOR_AD595_OFFSET)
 #define TEMP_AD8495(RAW) ((RAW) * 6.6 * 100.0 / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD8495_GAIN) + TEMP_SENSOR_AD8495_OFFSET)
 
+#if ENABLED(THERMISTOR_LUT)
+
+/**
+ * Start at the indexed entry for the 'raw' value and step up to the
+ * first entry at or over it, then interpolate proportionally between
+ * the under and over values. Same result as the bisect search.
+ */
+#define SCAN_THERMISTOR_TABLE(TBL,LEN,IDX) do{                        \
+  if (raw < int16_t(pgm_read_word(&TBL[0].value)))                    \
+    return int16_t(pgm_read_word(&TBL[0].celsius));                   \
+  if (raw > int16_t(pgm_read_word(&TBL[LEN-1].value)))                \
+    return int16_t(pgm_read_word(&TBL[LEN-1].celsius));               \
+  uint8_t m = IDX[raw / (THERMISTOR_LUT_STEP)];                       \
+  int16_t v10;                                                        \
+  while ((v10 = pgm_read_word(&TBL[m].value)) < raw) m++;             \
+  const int16_t v00 = pgm_read_word(&TBL[m-1].value),                 \
+                v01 = int16_t(pgm_read_word(&TBL[m-1].celsius)),      \
+                v11 = int16_t(pgm_read_word(&TBL[m-0].celsius));      \
+  return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);     \
+}while(0)
+
+#else
+
 /**
  * Bisect search for the range of the 'raw' value, then interpolate
  * proportionally between the under and over values.
  */
-#define SCAN_THERMISTOR_TABLE(TBL,LEN) do{                            \
+#define SCAN_THERMISTOR_TABLE(TBL,LEN,IDX) do{                        \
   uint8_t l = 0, r = LEN, m;                                          \
   for (;;) {                                                          \
     m = (l + r) >> 1;                                                 \
@@ -1324,6 +1676,8 @@ void Temperature::manage_heater() {
   }                                                                   \
 }while(0)
 
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -1396,6 +1750,25 @@ void Temperature::manage_heater() {
     SERIAL_EOL();
   }
 
+  static float user_thermistor_steinhart_hart(const user_thermistor_t &t, const int raw) {
+    // maximum adc value .. take into account the over sampling
+    const int adc_max = MAX_RAW_THERMISTOR_VALUE,
+              adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
+
+    const float adc_inverse = (adc_max - adc_raw) - 0.5f,
+                resistance = t.series_res * (adc_raw + 0.5f) / adc_inverse,
+                log_resistance = logf(resistance);
+
+    float value = t.sh_alpha;
+    value += log_resistance * t.beta_recip;
+    if (t.sh_c_coeff != 0)
+      value += t.sh_c_coeff * cu(log_resistance);
+    value = 1.0f / value;
+
+    // Return degrees C (up to 999, as the LCD only displays 3 digits)
+    return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
+  }
+
   float Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const int raw) {
     //#if (MOTHERBOARD == BOARD_RAMPS_14_EFB)
     //  static uint32_t clocks_total = 0;
@@ -1413,21 +1786,19 @@ void Temperature::manage_heater() {
       t.beta_recip   = 1.0f / t.beta;
       t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
                         - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
+      #if ENABLED(THERMISTOR_LUT)
+        for (uint16_t i = 0; i <= THERMISTOR_LUT_SIZE; i++)
+          user_thermistor_lut[t_index][i] = LROUND(16 * user_thermistor_steinhart_hart(t, i * (THERMISTOR_LUT_STEP)));
+      #endif
     }
 
-    // maximum adc value .. take into account the over sampling
-    const int adc_max = MAX_RAW_THERMISTOR_VALUE,
-              adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
-
-    const float adc_inverse = (adc_max - adc_raw) - 0.5f,
-                resistance = t.series_res * (adc_raw + 0.5f) / adc_inverse,
-                log_resistance = logf(resistance);
-
-    float value = t.sh_alpha;
-    value += log_resistance * t.beta_recip;
-    if (t.sh_c_coeff != 0)
-      value += t.sh_c_coeff * cu(log_resistance);
-    value = 1.0f / value;
+    #if ENABLED(THERMISTOR_LUT)
+      const uint16_t r = constrain(raw, 0, int(MAX_RAW_THERMISTOR_VALUE));
+      const int16_t * const lut = &user_thermistor_lut[t_index][r / (THERMISTOR_LUT_STEP)];
+      const float value = (lut[0] + (lut[1] - lut[0]) * float(r % (THERMISTOR_LUT_STEP)) * RECIPROCAL(THERMISTOR_LUT_STEP)) * 0.0625f;
+    #else
+      const float value = user_thermistor_steinhart_hart(t, raw);
+    #endif
 
     //#if (MOTHERBOARD == BOARD_RAMPS_14_EFB)
     //  int32_t clocks = TCNT5 - tcnt5;
@@ -1437,8 +1808,7 @@ void Temperature::manage_heater() {
     //  }
     //#endif
 
-    // Return degrees C (up to 999, as the LCD only displays 3 digits)
-    return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
+    return value;
   }
 #endif
 
@@ -1551,7 +1921,7 @@ void Temperature::manage_heater() {
     #if HOTEND_USES_THERMISTOR
       // Thermistor with conversion table?
       const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e], heater_ttbl_index[e]);
     #endif
 
     return 0;
@@ -1565,7 +1935,7 @@ void Temperature::manage_heater() {
     #if ENABLED(HEATER_BED_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_BED, raw);
     #elif ENABLED(HEATER_BED_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(BED_TEMPTABLE, BED_TEMPTABLE_LEN);
+      SCAN_THERMISTOR_TABLE(BED_TEMPTABLE, BED_TEMPTABLE_LEN, bed_ttbl_index);
     #elif ENABLED(HEATER_BED_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(HEATER_BED_USES_AD8495)
@@ -1584,7 +1954,7 @@ void Temperature::manage_heater() {
     #if ENABLED(HEATER_CHAMBER_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif ENABLED(HEATER_CHAMBER_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN);
+      SCAN_THERMISTOR_TABLE(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN, chamber_ttbl_index);
     #elif ENABLED(HEATER_CHAMBER_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(HEATER_CHAMBER_USES_AD8495)
@@ -1603,7 +1973,7 @@ void Temperature::manage_heater() {
     #if ENABLED(PROBE_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_PROBE, raw);
     #elif ENABLED(PROBE_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN);
+      SCAN_THERMISTOR_TABLE(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN, probe_ttbl_index);
     #elif ENABLED(PROBE_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(PROBE_USES_AD8495)
@@ -1682,6 +2052,25 @@ void Temperature::updateTemperaturesFromRawValues() {
  * Initialize the temperature manager
  * The manager is implemented by periodic calls to manage_heater()
  */
+#if ENABLED(THERMISTOR_LUT)
+  /**
+   * Bisect for the first raw value, from 'raw' in steps of 'step', that isn't
+   * beyond the limit. Same as stepping one by one for a monotonic sensor.
+   */
+  template<typename F>
+  static int16_t raw_limit_search(const int16_t raw, const int16_t step, F beyond) {
+    int16_t lo = 0, hi = (step > 0 ? MAX_RAW_THERMISTOR_VALUE - raw : raw) / ABS(step);
+    while (lo < hi) {
+      const int16_t mid = (lo + hi) / 2;
+      if (beyond(raw + mid * step)) lo = mid + 1; else hi = mid;
+    }
+    return raw + lo * step;
+  }
+  #define RAW_LIMIT(RAW, STEP, BEYOND) RAW = raw_limit_search(RAW, STEP, [&](const int16_t raw){ return BEYOND; })
+#else
+  #define RAW_LIMIT(RAW, STEP, BEYOND) for (;;) { const int16_t raw = RAW; if (!(BEYOND)) break; RAW += STEP; }
+#endif
+
 void Temperature::init() {
 
   TERN_(MAX6675_IS_MAX31865, max31865.begin(MAX31865_2WIRE)); // MAX31865_2WIRE, MAX31865_3WIRE, MAX31865_4WIRE
@@ -1713,6 +2102,10 @@ void Temperature::init() {
     last_e_position = 0;
   #endif
 
+  #if ENABLED(MPCTEMP)
+    HOTEND_LOOP() temp_hotend[e].modeled_block_temp = NAN;
+  #endif
+
   #if HAS_HEATER_0
     #ifdef ALFAWISE_UX0
       OUT_WRITE_OD(HEATER_0_PIN, HEATER_0_INVERTING);
@@ -1894,19 +2287,32 @@ void Temperature::init() {
   // Wait for temperature measurement to settle
   delay(250);
 
+  #if ENABLED(THERMISTOR_LUT)
+    #if HOTEND_USES_THERMISTOR
+      LOOP_L_N(e, COUNT(heater_ttbl_map)) thermistor_index_init(heater_ttbl_index[e], heater_ttbl_map[e], heater_ttbllen_map[e]);
+    #endif
+    #if ENABLED(HEATER_BED_USES_THERMISTOR) && DISABLED(HEATER_BED_USER_THERMISTOR)
+      thermistor_index_init(bed_ttbl_index, BED_TEMPTABLE, BED_TEMPTABLE_LEN);
+    #endif
+    #if ENABLED(HEATER_CHAMBER_USES_THERMISTOR) && DISABLED(HEATER_CHAMBER_USER_THERMISTOR)
+      thermistor_index_init(chamber_ttbl_index, CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN);
+    #endif
+    #if ENABLED(PROBE_USES_THERMISTOR) && DISABLED(PROBE_USER_THERMISTOR)
+      thermistor_index_init(probe_ttbl_index, PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN);
+    #endif
+  #endif
+
   #if HAS_HOTEND
 
     #define _TEMP_MIN_E(NR) do{ \
       const int16_t tmin = _MAX(HEATER_ ##NR## _MINTEMP, TERN(HEATER_##NR##_USER_THERMISTOR, 0, (int16_t)pgm_read_word(&HEATER_ ##NR## _TEMPTABLE[HEATER_ ##NR## _SENSOR_MINTEMP_IND].celsius))); \
       temp_range[NR].mintemp = tmin; \
-      while (analog_to_celsius_hotend(temp_range[NR].raw_min, NR) < tmin) \
-        temp_range[NR].raw_min += TEMPDIR(NR) * (OVERSAMPLENR); \
+      RAW_LIMIT(temp_range[NR].raw_min, TEMPDIR(NR) * (OVERSAMPLENR), analog_to_celsius_hotend(raw, NR) < tmin); \
     }while(0)
     #define _TEMP_MAX_E(NR) do{ \
       const int16_t tmax = _MIN(HEATER_ ##NR## _MAXTEMP, TERN(HEATER_##NR##_USER_THERMISTOR, 2000, (int16_t)pgm_read_word(&HEATER_ ##NR## _TEMPTABLE[HEATER_ ##NR## _SENSOR_MAXTEMP_IND].celsius) - 1)); \
       temp_range[NR].maxtemp = tmax; \
-      while (analog_to_celsius_hotend(temp_range[NR].raw_max, NR) > tmax) \
-        temp_range[NR].raw_max -= TEMPDIR(NR) * (OVERSAMPLENR); \
+      RAW_LIMIT(temp_range[NR].raw_max, -TEMPDIR(NR) * (OVERSAMPLENR), analog_to_celsius_hotend(raw, NR) > tmax); \
     }while(0)
 
     #define _MINMAX_TEST(N,M) (HOTENDS > N && THERMISTOR_HEATER_##N && THERMISTOR_HEATER_##N != 998 && THERMISTOR_HEATER_##N != 999 && defined(HEATER_##N##_##M##TEMP))
@@ -1964,19 +2370,19 @@ void Temperature::init() {
 
   #if HAS_HEATED_BED
     #ifdef BED_MINTEMP
-      while (analog_to_celsius_bed(mintemp_raw_BED) < BED_MINTEMP) mintemp_raw_BED += TEMPDIR(BED) * (OVERSAMPLENR);
+      RAW_LIMIT(mintemp_raw_BED, TEMPDIR(BED) * (OVERSAMPLENR), analog_to_celsius_bed(raw) < BED_MINTEMP);
     #endif
     #ifdef BED_MAXTEMP
-      while (analog_to_celsius_bed(maxtemp_raw_BED) > BED_MAXTEMP) maxtemp_raw_BED -= TEMPDIR(BED) * (OVERSAMPLENR);
+      RAW_LIMIT(maxtemp_raw_BED, -TEMPDIR(BED) * (OVERSAMPLENR), analog_to_celsius_bed(raw) > BED_MAXTEMP);
     #endif
   #endif // HAS_HEATED_BED
 
   #if HAS_HEATED_CHAMBER
     #ifdef CHAMBER_MINTEMP
-      while (analog_to_celsius_chamber(mintemp_raw_CHAMBER) < CHAMBER_MINTEMP) mintemp_raw_CHAMBER += TEMPDIR(CHAMBER) * (OVERSAMPLENR);
+      RAW_LIMIT(mintemp_raw_CHAMBER, TEMPDIR(CHAMBER) * (OVERSAMPLENR), analog_to_celsius_chamber(raw) < CHAMBER_MINTEMP);
     #endif
     #ifdef CHAMBER_MAXTEMP
-      while (analog_to_celsius_chamber(maxtemp_raw_CHAMBER) > CHAMBER_MAXTEMP) maxtemp_raw_CHAMBER -= TEMPDIR(CHAMBER) * (OVERSAMPLENR);
+      RAW_LIMIT(maxtemp_raw_CHAMBER, -TEMPDIR(CHAMBER) * (OVERSAMPLENR), analog_to_celsius_chamber(raw) > CHAMBER_MAXTEMP);
     #endif
   #endif
 
@@ -3083,8 +3489,10 @@ void Temperature::tick() {
       if (auto_report_temp_interval && ELAPSED(millis(), next_temp_report_ms)) {
         next_temp_report_ms = millis() + 1000UL * auto_report_temp_interval;
         PORT_REDIRECT(SERIAL_BOTH);
-        print_heater_states(active_extruder);
-        SERIAL_EOL();
+        if (serial_report_fits()) {
+          print_heater_states(active_extruder);
+          SERIAL_EOL();
+        }
       }
     }
 
@@ -69,6 +69,18 @@ hotend_pid_t;
   typedef IF<(LPQ_MAX_LEN > 255), uint16_t, uint8_t>::type lpq_ptr_t;
 #endif
 
+#if ENABLED(MPCTEMP)
+  // Thermal model of a hotend for Model Predictive Control
+  typedef struct {
+    float heater_power,                 // (W) Heater cartridge power
+          block_heat_capacity,          // (J/K) Heat capacity of the heater block
+          sensor_responsiveness,        // (1/s) Rate at which the sensor follows the block
+          ambient_xfer_coeff_fan0,      // (W/K) Heat loss to ambient with the part fan off
+          fan255_adjustment,            // (W/K) Additional heat loss with the part fan at full speed
+          filament_heat_capacity_permm; // (J/K/mm) Heat carried off by each mm of filament
+  } MPC_t;
+#endif
+
 #define PID_PARAM(F,H) _PID_##F(TERN(PID_PARAMS_PER_HOTEND, H, 0))
 #define _PID_Kp(H) TERN(PIDTEMP, Temperature::temp_hotend[H].pid.Kp, NAN)
 #define _PID_Ki(H) TERN(PIDTEMP, Temperature::temp_hotend[H].pid.Ki, NAN)
@@ -164,6 +176,10 @@ enum ADCSensorState : char {
   #define unscalePID_d(d) ( float(d) * PID_dT )
 #endif
 
+#if ENABLED(MPCTEMP)
+  #define MPC_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / TEMP_TIMER_FREQUENCY)
+#endif
+
 #if BOTH(HAS_LCD_MENU, G26_MESH_VALIDATION)
   #define G26_CLICK_CAN_CANCEL 1
 #endif
@@ -190,7 +206,15 @@ struct PIDHeaterInfo : public HeaterInfo {
   T pid;  // Initialized by settings.load()
 };
 
-#if ENABLED(PIDTEMP)
+#if ENABLED(MPCTEMP)
+  // A heater following a thermal model
+  typedef struct MPCHeaterInfo : public HeaterInfo {
+    MPC_t constants;              // Initialized by settings.load()
+    float modeled_ambient_temp,
+          modeled_block_temp,     // NAN until the model is seeded from the sensor
+          modeled_sensor_temp;
+  } hotend_info_t;
+#elif ENABLED(PIDTEMP)
   typedef struct PIDHeaterInfo<hotend_pid_t> hotend_info_t;
 #else
   typedef heater_info_t hotend_info_t;
@@ -388,6 +412,8 @@ class Temperature {
       static lpq_ptr_t lpq_ptr;
     #endif
 
+    TERN_(MPCTEMP, static int32_t mpc_e_position);
+
     TERN_(HAS_HOTEND, static temp_range_t temp_range[HOTENDS]);
 
     #if HAS_HEATED_BED
@@ -451,6 +477,7 @@ class Temperature {
         //if (!WITHIN(t_index, 0, USER_THERMISTORS - 1)) return false;
         if (!WITHIN(value, 1, 1000000)) return false;
         user_thermistor[t_index].series_res = value;
+        TERN_(THERMISTOR_LUT, user_thermistor[t_index].pre_calc = true);
         return true;
       }
       static bool set_res25(int8_t t_index, float value) {
@@ -758,6 +785,11 @@ class Temperature {
 
     #endif
 
+    /**
+     * Identify the hotend thermal model in response to M306 T
+     */
+    TERN_(MPCTEMP, static void MPC_autotune(const uint8_t e));
+
     #if ENABLED(PROBING_HEATERS_OFF)
       static void pause(const bool p);
       FORCE_INLINE static bool is_paused() { return paused; }
@@ -89,6 +89,9 @@
 
 // Send command and return error code. Return zero for OK
 uint8_t Sd2Card::cardCommand(const uint8_t cmd, const uint32_t arg) {
+  // End a read-ahead transfer before any other command
+  TERN_(SD_READ_AHEAD, if (cmd != CMD12) streamStop());
+
   // Select card
   chipSelect();
 
@@ -240,6 +243,10 @@ bool Sd2Card::init(const uint8_t sckRateID, const pin_t chipSelectPin) {
 
   errorCode_ = type_ = 0;
   chipSelectPin_ = chipSelectPin;
+  #if ENABLED(SD_READ_AHEAD)
+    streamBlock_ = aheadFirst_ = NO_BLOCK;
+    aheadCount_ = 0;
+  #endif
   // 16-bit init start time allows over a minute
   const millis_t init_timeout = millis() + SD_INIT_TIMEOUT;
   uint32_t arg;
@@ -339,6 +346,8 @@ bool Sd2Card::init(const uint8_t sckRateID, const pin_t chipSelectPin) {
  * \return true for success, false for failure.
  */
 bool Sd2Card::readBlock(uint32_t blockNumber, uint8_t* dst) {
+  TERN_(SD_READ_AHEAD, if (readAheadTake(blockNumber, dst)) return true);
+
   #if IS_TEENSY_35_36 || IS_TEENSY_40_41
     return 0 == SDHC_CardReadBlock(dst, blockNumber);
   #endif
@@ -519,6 +528,69 @@ bool Sd2Card::readStop() {
   return success;
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Set the next block the reader expects. Keep the ring if it holds
+   * that block or is about to fetch it, otherwise restart it there.
+   */
+  void Sd2Card::readAheadHint(const uint32_t block) {
+    if (block - aheadFirst_ <= aheadCount_) return;
+    aheadFirst_ = block;
+    aheadHead_ = aheadCount_ = 0;
+  }
+
+  /**
+   * Prefetch the block after the end of the ring. The CMD18 transfer
+   * stays open between calls while the blocks are contiguous.
+   */
+  void Sd2Card::readAheadTask() {
+    if (aheadFirst_ == NO_BLOCK || aheadCount_ >= SD_READ_AHEAD_BLOCKS) return;
+
+    const uint32_t block = aheadFirst_ + aheadCount_;
+    if (streamBlock_ != block) {
+      if (!readStart(block)) { readAheadReset(); return; }
+      streamBlock_ = block;
+    }
+
+    uint8_t slot = aheadHead_ + aheadCount_;
+    if (slot >= SD_READ_AHEAD_BLOCKS) slot -= SD_READ_AHEAD_BLOCKS;
+    if (readData(aheadBuf_[slot])) {
+      aheadCount_++;
+      streamBlock_++;
+    }
+    else
+      readAheadReset();   // Leave the block to a plain readBlock()
+  }
+
+  // Drop the prefetched blocks and end the transfer
+  void Sd2Card::readAheadReset() {
+    streamStop();
+    aheadFirst_ = NO_BLOCK;
+    aheadHead_ = aheadCount_ = 0;
+  }
+
+  // Copy a block from the ring, dropping it and any blocks before it
+  bool Sd2Card::readAheadTake(const uint32_t block, uint8_t* dst) {
+    const uint32_t skip = block - aheadFirst_;
+    if (skip >= aheadCount_) return false;
+    uint8_t slot = aheadHead_ + skip;
+    if (slot >= SD_READ_AHEAD_BLOCKS) slot -= SD_READ_AHEAD_BLOCKS;
+    memcpy(dst, aheadBuf_[slot], 512);
+    aheadHead_ = slot + 1 < SD_READ_AHEAD_BLOCKS ? slot + 1 : 0;
+    aheadCount_ -= skip + 1;
+    aheadFirst_ = block + 1;
+    return true;
+  }
+
+  void Sd2Card::streamStop() {
+    if (streamBlock_ == NO_BLOCK) return;
+    streamBlock_ = NO_BLOCK;
+    readStop();
+  }
+
+#endif // SD_READ_AHEAD
+
 /**
  * Set the SPI clock rate.
  *
@@ -562,6 +634,9 @@ bool Sd2Card::writeBlock(uint32_t blockNumber, const uint8_t* src) {
     return 0 == SDHC_CardWriteBlock(src, blockNumber);
   #endif
 
+  // Don't serve stale data from the read-ahead ring
+  TERN_(SD_READ_AHEAD, if (blockNumber - aheadFirst_ < aheadCount_) readAheadReset());
+
   bool success = false;
   if (type() != SD_CARD_TYPE_SDHC) blockNumber <<= 9;   // Use address if not SDHC card
   if (!cardCommand(CMD24, blockNumber)) {
@@ -632,6 +707,8 @@ bool Sd2Card::writeData(const uint8_t token, const uint8_t* src) {
 bool Sd2Card::writeStart(uint32_t blockNumber, const uint32_t eraseCount) {
   if (ENABLED(SDCARD_READONLY)) return false;
 
+  TERN_(SD_READ_AHEAD, readAheadReset());
+
   bool success = false;
   if (!cardAcmd(ACMD23, eraseCount)) {                    // Send pre-erase count
     if (type() != SD_CARD_TYPE_SDHC) blockNumber <<= 9;   // Use address if not SDHC card
@@ -162,6 +162,18 @@ public:
   bool writeStart(uint32_t blockNumber, const uint32_t eraseCount);
   bool writeStop();
 
+  #if ENABLED(SD_READ_AHEAD)
+    /**
+     * Read-ahead of sequential blocks with a multiple block read (CMD18).
+     * readAheadHint() names the next block a file will need, readAheadTask()
+     * prefetches one block per call into a ring, and readBlock() serves
+     * blocks from the ring. Any other card command ends the transfer first.
+     */
+    void readAheadHint(const uint32_t block);
+    void readAheadTask();
+    void readAheadReset();
+  #endif
+
 private:
   uint8_t chipSelectPin_,
           errorCode_,
@@ -169,6 +181,17 @@ private:
           status_,
           type_;
 
+  #if ENABLED(SD_READ_AHEAD)
+    static constexpr uint32_t NO_BLOCK = 0xFFFFFFFF;
+    uint8_t aheadBuf_[SD_READ_AHEAD_BLOCKS][512];
+    uint32_t aheadFirst_ = NO_BLOCK,    // Block held in aheadBuf_[aheadHead_]
+             streamBlock_ = NO_BLOCK;   // Next block of the open CMD18 transfer
+    uint8_t aheadHead_ = 0, aheadCount_ = 0;
+
+    bool readAheadTake(const uint32_t block, uint8_t* dst);
+    void streamStop();
+  #endif
+
   // private functions
   inline uint8_t cardAcmd(const uint8_t cmd, const uint32_t arg) {
     cardCommand(CMD55, 0);
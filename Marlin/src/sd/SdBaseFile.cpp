@@ -1052,6 +1052,9 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
       uint8_t* src = vol_->cache()->data + offset;
       memcpy(dst, src, n);
     }
+    #if ENABLED(SD_READ_AHEAD)
+      if (flags_ & F_FILE_READ_AHEAD) vol_->sdCard()->readAheadHint(block + 1);
+    #endif
     dst += n;
     curPosition_ += n;
     toRead -= n;
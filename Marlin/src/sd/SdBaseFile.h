@@ -346,6 +346,16 @@ class SdBaseFile {
   SdVolume* volume() const { return vol_; }
   int16_t write(const void* buf, uint16_t nbyte);
 
+  #if ENABLED(SD_READ_AHEAD)
+    /**
+     * Prefetch the blocks that follow each read of this file.
+     * The card has one read-ahead ring, so use it for one file at a time.
+     */
+    void readAhead(const bool onoff) {
+      if (onoff) flags_ |= F_FILE_READ_AHEAD; else flags_ &= ~F_FILE_READ_AHEAD;
+    }
+  #endif
+
  private:
   friend class SdFat;           // allow SdFat to set cwd_
   static SdBaseFile* cwd_;      // global pointer to cwd dir
@@ -355,6 +365,7 @@ class SdBaseFile {
 
   // bits defined in flags_
   static uint8_t const F_OFLAG = (O_ACCMODE | O_APPEND | O_SYNC),   // should be 0x0F
+                       F_FILE_READ_AHEAD = 0x40,                    // prefetch the following blocks on read
                        F_FILE_DIR_DIRTY = 0x80;                     // sync of directory entry required
 
   // private data
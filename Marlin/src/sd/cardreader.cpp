@@ -53,6 +53,10 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  #include "../feature/binary_gcode.h"
+#endif
+
 #define DEBUG_OUT EITHER(DEBUG_CARDREADER, MARLIN_DEV_MODE)
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
@@ -471,6 +475,7 @@ void CardReader::openAndPrintFile(const char *name) {
 void CardReader::startFileprint() {
   if (isMounted()) {
     flag.sdprinting = true;
+    TERN_(SD_READ_AHEAD, file.readAhead(true));
     TERN_(SD_RESORT, flush_presort());
   }
 }
@@ -480,6 +485,7 @@ void CardReader::endFilePrint(TERN_(SD_RESORT, const bool re_sort/*=false*/)) {
   TERN_(DWIN_CREALITY_LCD, HMI_flag.print_finish = flag.sdprinting);
   flag.sdprinting = flag.abort_sd_printing = false;
   if (isFileOpen()) file.close();
+  TERN_(SD_READ_AHEAD, sd2card.readAheadReset());
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -679,11 +685,21 @@ void CardReader::report_status() {
 }
 
 void CardReader::write_command(char * const buf) {
+  file.writeError = false;
+
+  #if ENABLED(BINARY_GCODE)
+    // Save a binary frame unchanged. It will be read back as a frame.
+    if (BinaryGcode::is_frame(buf)) {
+      file.write(buf, BinaryGcode::frame_size(buf));
+      if (file.writeError) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+      return;
+    }
+  #endif
+
   char* begin = buf;
   char* npos = nullptr;
   char* end = buf + strlen(buf) - 1;
 
-  file.writeError = false;
   if ((npos = strchr(buf, 'N')) != nullptr) {
     begin = strchr(npos, ' ') + 1;
     end = strchr(npos, '*') - 1;
@@ -1183,7 +1199,7 @@ void CardReader::fileHasFinished() {
     if (auto_report_sd_interval && ELAPSED(current_ms, next_sd_report_ms)) {
       next_sd_report_ms = current_ms + 1000UL * auto_report_sd_interval;
       PORT_REDIRECT(auto_report_port);
-      report_status();
+      if (serial_report_fits()) report_status();
     }
   }
 #endif // AUTO_REPORT_SD_STATUS
@@ -86,6 +86,11 @@ public:
   // Handle media insert/remove
   static void manage_media();
 
+  #if ENABLED(SD_READ_AHEAD)
+    // Prefetch blocks of the file being printed. Called from idle.
+    static inline void read_ahead() { if (flag.sdprinting) sd2card.readAheadTask(); }
+  #endif
+
   // SD Card Logging
   static void openLogFile(char * const path);
   static void write_command(char * const buf);
@@ -10,3 +10,13 @@ env.Append(CXXFLAGS=[
   #"-Wno-maybe-uninitialized",
   #"-Wno-sign-compare"
 ])
+
+#
+# Build delta.cpp without errno for math functions, so SQRT has no error
+# branch and the batched inverse kinematics can vectorize. A per-function
+# optimize attribute doesn't change this, so it's set for the file.
+#
+def delta_no_math_errno(env, node):
+  return env.Object(node, CCFLAGS=env["CCFLAGS"] + ["-fno-math-errno"])
+
+env.AddBuildMiddleware(delta_no_math_errno, "*/src/module/delta.cpp")
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+#
+# binary_gcode.py
+#
+# Convert a G-code file to BINARY_GCODE frames (see Marlin/src/feature/binary_gcode.h).
+# Commands with only numeric parameters become frames. Everything else, such as
+# M117 messages, is kept as a text line, so the output can be printed from SD.
+# M108, M112, and M410 also stay text, so the emergency parser can see them.
+#
+# Usage: binary_gcode.py in.gcode out.bgcode
+#
+import re, struct, sys
+
+START = 0xB5
+# M-codes that take a string, and the ones the emergency parser must see as text
+TEXT_MCODES = { 16, 23, 28, 30, 32, 33, 108, 112, 117, 118, 410, 928 } | set(range(810, 820))
+WORD = re.compile(r'([A-Z])([-+]?(?:\d+\.?\d*|\.\d+))?')
+
+def crc16(data):
+	crc = 0
+	for b in data:
+		crc ^= b << 8
+		for _ in range(8):
+			crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+			crc &= 0xFFFF
+	return crc
+
+def encode(line):
+	"""Return a frame for one command line, or None to keep it as text."""
+	line = line.split(';', 1)[0].strip().upper()
+	m = re.fullmatch(r'([GMT])(\d+)(?:\.(\d+))?((?:\s*[A-Z][-+.\d]*)*)\s*', line)
+	if not m: return None
+	letter, code, sub = 'GMT'.index(m.group(1)), int(m.group(2)), m.group(3)
+	if code > 0x3FFF or (letter == 1 and code in TEXT_MCODES): return None
+
+	params, bare, values = 0, 0, {}
+	for p, v in WORD.findall(m.group(4).replace(' ', '')):
+		bit = ord(p) - ord('A')
+		params |= 1 << bit
+		if v: values[bit] = float(v)
+		else: bare |= 1 << bit
+
+	flags = (2 if sub else 0) | (4 if bare else 0)
+	body = struct.pack('<HBI', (letter << 14) | code, flags, params)
+	if sub: body += struct.pack('<B', int(sub))
+	if bare: body += struct.pack('<I', bare)
+	for bit in sorted(values): body += struct.pack('<f', values[bit])
+
+	head = bytes([START, len(body)])
+	return head + body + struct.pack('<H', crc16(head[1:] + body))
+
+def main():
+	if len(sys.argv) != 3:
+		print("Usage: %s in.gcode out.bgcode" % sys.argv[0], file=sys.stderr)
+		sys.exit(1)
+	with open(sys.argv[1]) as fin, open(sys.argv[2], 'wb') as fout:
+		for line in fin:
+			frame = encode(line)
+			if frame: fout.write(frame)
+			elif line.split(';', 1)[0].strip(): fout.write(line.rstrip('\r\n').encode() + b'\n')
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+#
+# event_trace.py
+#
+# Convert the binary output of M992 (EVENT_TRACE) to a Chrome trace
+# (chrome://tracing or ui.perfetto.dev) or to CSV.
+#
+# Capture the raw serial output of M992 to a file, for example:
+#   stty -F /dev/ttyACM0 115200 raw ; cat /dev/ttyACM0 > capture.bin & echo M992 > /dev/ttyACM0
+#
+# Usage: event_trace.py capture.bin out.json|out.csv
+#
+import json, re, struct, sys
+
+RECORD = struct.Struct('<IBBH')
+EVENTS = { 1: 'block_queued', 2: 'block_start', 3: 'block_done', 4: 'command_queue', 5: 'idle' }
+
+def read_records(data):
+	"""Return (time_us, event, value, repeat) tuples from the first M992 dump in a capture."""
+	m = re.search(rb'Trace: (\d+)\r?\n', data)
+	if not m: raise ValueError("No 'Trace:' header found")
+	count, start = int(m.group(1)), m.end()
+	if len(data) < start + count * RECORD.size: raise ValueError("Capture ends before the last record")
+
+	records, wrap, last = [], 0, None
+	for i in range(count):
+		t, event, repeat, value = RECORD.unpack_from(data, start + i * RECORD.size)
+		if last is not None and t + wrap < last - 0x80000000: wrap += 0x100000000  # micros() overflow
+		last = t + wrap
+		records.append((last, event, value, repeat))
+	return records
+
+def chrome_trace(records):
+	t0 = records[0][0] if records else 0
+	out, in_block = [], False
+	for t, event, value, repeat in records:
+		ts = t - t0
+		name = EVENTS.get(event, 'event_%d' % event)
+		if event == 2:
+			out.append({ 'name': 'block', 'ph': 'B', 'ts': ts, 'pid': 0, 'tid': 'stepper' })
+			in_block = True
+		elif event == 3 and in_block:
+			out.append({ 'name': 'block', 'ph': 'E', 'ts': ts, 'pid': 0, 'tid': 'stepper' })
+			in_block = False
+		elif event == 5:
+			# Merged idle calls are drawn as one span ending at the last call
+			out.append({ 'name': 'idle', 'ph': 'X', 'ts': ts - value, 'dur': value, 'pid': 0, 'tid': 'main', 'args': { 'calls': repeat + 1 } })
+			continue
+		if event in (1, 2, 3):
+			out.append({ 'name': 'planner blocks', 'ph': 'C', 'ts': ts, 'pid': 0, 'args': { 'blocks': value } })
+		elif event == 4:
+			out.append({ 'name': 'command queue', 'ph': 'C', 'ts': ts, 'pid': 0, 'args': { 'commands': value } })
+	return { 'traceEvents': out, 'displayTimeUnit': 'ms' }
+
+def main():
+	if len(sys.argv) != 3:
+		print("Usage: %s capture.bin out.json|out.csv" % sys.argv[0], file=sys.stderr)
+		sys.exit(1)
+	with open(sys.argv[1], 'rb') as f: records = read_records(f.read())
+	with open(sys.argv[2], 'w') as f:
+		if sys.argv[2].endswith('.csv'):
+			f.write('time_us,event,value,repeat\n')
+			for t, event, value, repeat in records: f.write('%d,%s,%d,%d\n' % (t, EVENTS.get(event, event), value, repeat))
+		else:
+			json.dump(chrome_trace(records), f)
+	print("%d events" % len(records))
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,31 @@
+#!/usr/bin/env bash
+#
+# linux_benchmark.sh
+#
+# Replay G-code files through the linux_native simulator on the virtual clock
+# and print the MOTION_BENCHMARK (M990) report for each one.
+#
+# Usage: linux_benchmark.sh file.gcode [file.gcode ...]
+#
+# Enable MOTION_BENCHMARK and build with:
+#   pio run -e linux_native_benchmark
+#
+# Set MARLIN_BIN to use another simulator binary.
+# Heater commands are dropped; the simulated heaters are not meant for printing.
+#
+
+BIN=${MARLIN_BIN:-.pio/build/linux_native_benchmark/program}
+
+[[ -x $BIN ]] || { echo "Simulator not found: $BIN" >&2 ; exit 1 ; }
+[[ -n $@ ]] || { echo "Usage: $(basename $0) file.gcode [file.gcode ...]" >&2 ; exit 1 ; }
+
+for F in "$@"; do
+  echo "== $F"
+  {
+    echo "M302 P1"   # Allow cold extrusion
+    echo "M990 R"
+    sed -E '/^[[:space:]]*M(104|109|140|190)([^0-9]|$)/d' "$F"
+    echo "M400"
+    echo "M990"
+  } | "$BIN" | sed -n '/^Motion benchmark/,/^Benchmark end/p;/^Benchmark end/q'
+done
@@ -519,6 +519,38 @@
   #endif
 #endif // PIDTEMP
 
+/**
+ * Model Predictive Control for hotend
+ *
+ * Use a thermal model of the heater block and sensor instead of PID.
+ * Heat lost to the part fan and to the filament is anticipated, the latter
+ * from the extrusion rate planned in the motion queue, so sudden changes in
+ * flow cause much smaller temperature dips. Disable PIDTEMP to use MPC.
+ *
+ * Run 'M306 T' to measure the model constants, then 'M500' to save them.
+ * Set the heater power and filament heat capacity before tuning, and park
+ * the nozzle just above the bed so the part fan blows as it does in a print.
+ */
+//#define MPCTEMP
+#if ENABLED(MPCTEMP)
+  #define MPC_MAX BANG_MAX                            // (0..255) Current to nozzle while MPC is active.
+  #define MPC_HEATER_POWER { 40.0f }                  // (W) Heat cartridge powers.
+
+  // Measured physical constants from M306
+  #define MPC_BLOCK_HEAT_CAPACITY { 16.7f }           // (J/K) Heat block heat capacities.
+  #define MPC_SENSOR_RESPONSIVENESS { 0.22f }         // (1/s) Rate at which the sensor follows the block.
+  #define MPC_AMBIENT_XFER_COEFF { 0.068f }           // (W/K) Heat transfer coefficients from heat block to room air with fan off.
+  #define MPC_AMBIENT_XFER_COEFF_FAN255 { 0.097f }    // (W/K) Heat transfer coefficients from heat block to room air with fan on full.
+  #define FILAMENT_HEAT_CAPACITY_PERMM { 5.6e-3f }    // (J/K/mm) 1.75mm PLA: 5.6e-3, 2.85mm PLA: 1.5e-2, 1.75mm PETG: 5.3e-3
+
+  // Advanced options
+  #define MPC_SMOOTHING_FACTOR 0.5f                   // (0.0...1.0) Noisy temperature sensors may need a lower value for stabilization.
+  #define MPC_MIN_AMBIENT_CHANGE 1.0f                 // (K/s) Modeled ambient temperature rate of change, when correcting model inaccuracies.
+  #define MPC_STEADYSTATE 0.5f                        // (K/s) Temperature change rate for steady state logic to be enforced.
+  #define MPC_FEED_FORWARD_TIME 1.0f                  // (s) How far ahead in the planner queue to look for extrusion.
+  #define MPC_TUNING_TEMP 200                         // (°C) Target temperature for M306 autotuning.
+#endif
+
 //===========================================================================
 //====================== PID > Bed Temperature Control ======================
 //===========================================================================
@@ -1078,6 +1110,27 @@
 
 #define Z_PROBE_LOW_POINT          -2 // Farthest distance below the trigger-point to go before stopping
 
+/**
+ * Fast Scan Probing
+ *
+ * Probe G29 grids (ABL and UBL) without the full raise between points.
+ * After the first point the probe stays low, rising only PROBE_FAST_SCAN_HOP
+ * above the last contact to move to the next point, then descending once
+ * at Z_PROBE_SPEED_FAST. The moves for a point are queued together and the
+ * Z is the stepper position latched when the probe triggered. A point that
+ * doesn't trigger within PROBE_FAST_SCAN_DEPTH below the last contact is
+ * probed the usual way. Scanned points take a single reading, ignoring
+ * MULTIPLE_PROBING.
+ *
+ * For fixed inductive and contact probes. The hop must clear any rise in
+ * the bed from one point to the next.
+ */
+//#define PROBE_FAST_SCAN
+#if ENABLED(PROBE_FAST_SCAN)
+  #define PROBE_FAST_SCAN_HOP    1.0 // (mm) Height above the last contact for moves between points
+  #define PROBE_FAST_SCAN_DEPTH  2.0 // (mm) Farthest distance below the last contact to search
+#endif
+
 // For M851 give a range for adjusting the Z probe offset
 #define Z_PROBE_OFFSET_RANGE_MIN -4
 #define Z_PROBE_OFFSET_RANGE_MAX -1
@@ -1366,6 +1419,9 @@
   //#define UBL_Z_RAISE_WHEN_OFF_MESH 2.5 // When the nozzle is off the mesh, this value is used
                                           // as the Z-Height correction value.
 
+  //#define UBL_CELL_CACHE            // Keep bilinear coefficients for each mesh cell so a Z correction
+                                      // is a single lookup. Uses 16 bytes of RAM per mesh point.
+
 #elif ENABLED(MESH_BED_LEVELING)
 
   //===========================================================================
@@ -1520,6 +1576,7 @@
 #define EEPROM_BOOT_SILENT    // Keep M503 quiet and only give errors during first load
 #if ENABLED(EEPROM_SETTINGS)
   //#define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
+  //#define FLASH_EEPROM_LOG  // Append only changed data to flash, erasing only when full. (STM32F4 with FLASH_EEPROM_LEVELING)
 #endif
 
 //
@@ -113,6 +113,25 @@
   #define CHAMBER_BETA                 3950    // Beta value
 #endif
 
+/**
+ * Thermistor Lookup Tables
+ *
+ * Convert thermistor readings with a uniform index into the raw value range
+ * instead of searching the conversion table for every reading.
+ *  - Tables get an index of 2^THERMISTOR_LUT_BITS bytes, so each reading
+ *    checks one or two table entries. The result is unchanged.
+ *  - Custom thermistors (1000) get 2^THERMISTOR_LUT_BITS+1 temperatures
+ *    (2 bytes each) to interpolate instead of a log() for every reading.
+ *    They are rebuilt when M305 changes the parameters. With 8 bits a 100K
+ *    thermistor is within 0.4°C of the formula up to 300°C, but fewer bits
+ *    lose accuracy quickly.
+ *  - Raw MINTEMP / MAXTEMP limits are found by bisection at startup.
+ */
+//#define THERMISTOR_LUT
+#if ENABLED(THERMISTOR_LUT)
+  #define THERMISTOR_LUT_BITS 8   // 4 to 8
+#endif
+
 //
 // Hephestos 2 24V heated bed upgrade kit.
 // https://store.bq.com/en/heated-bed-kit-hephestos2
@@ -1332,6 +1351,16 @@
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   #define BINARY_FILE_TRANSFER
 
+  /**
+   * Prefetch the file being printed from the idle loop with a multiple block
+   * read, so dense G-code with many short segments doesn't stall on each block.
+   * Uses 512 bytes of RAM per block. Requires an SPI SD card (not SDIO or USB).
+   */
+  //#define SD_READ_AHEAD
+  #if ENABLED(SD_READ_AHEAD)
+    #define SD_READ_AHEAD_BLOCKS 4          // Blocks to keep ahead of the reader (2-16)
+  #endif
+
   /**
    * Set this option to one of the following (or the board's defaults apply):
    *
@@ -1385,6 +1414,14 @@
   // Swap the CW/CCW indicators in the graphics overlay
   //#define OVERLAY_GFX_REVERSE
 
+  // Save display transfers by only sending the page stripes that changed since they were last sent.
+  // Every 20th frame is sent whole, to repair stripes garbled by noise.
+  // Not for LIGHTWEIGHT_UI or upscaled TFT displays.
+  //#define DOGM_SKIP_UNCHANGED_PAGES
+
+  // Keep drawing page stripes for up to this long (ms) in each idle() call, instead of one per call
+  //#define DOGM_PAGE_BUDGET_MS 2
+
   /**
    * ST7920-based LCDs can emulate a 16 x 4 character display using
    * the ST7920 character-generator for very fast screen updates.
@@ -1594,6 +1631,16 @@
   //#define TFT_BTOKMENU_COLOR 0x145F // 00010 100010 11111 Cyan
 #endif
 
+//
+// Color UI Options
+//
+//#define TFT_DIRTY_REGIONS             // Only send screen regions whose content changed. M996 reports pixels per frame.
+#if ENABLED(TFT_DIRTY_REGIONS)
+  #define TFT_DIRTY_REGION_COUNT 24     // Regions to remember. The status screen uses about 16.
+#endif
+//#define TFT_DOUBLE_BUFFER             // Draw the next canvas stripe while DMA sends the last one. Splits TFT_BUFFER_SIZE in two.
+//#define TFT_FRAME_BUDGET_MS 2         // (ms) Keep drawing for up to this long per idle() while the planner has moves to spare
+
 //
 // ADC Button Debounce
 //
@@ -1681,6 +1728,32 @@
   #define EXPERIMENTAL_SCURVE // Enable this option to permit S-Curve Acceleration
 #endif
 
+// @section motion
+
+/**
+ * Input Shaping
+ *
+ * Cancel the ringing of the X and Y axes at a tuned frequency by splitting each
+ * step into delayed impulses. Allows higher accelerations without ghosting.
+ * Print a ringing tower, measure the ringing period, and set F = 1 / period.
+ *
+ * Shaper types: 0=None, 1=ZV, 2=ZVD, 3=MZV, 4=EI
+ * ZV is the shortest (1/2 period). ZVD and EI tolerate a less exact frequency.
+ *
+ * Use M593 to tune at runtime. Not for DELTA, SCARA or 8-bit boards.
+ */
+//#define INPUT_SHAPING
+#if ENABLED(INPUT_SHAPING)
+  #define SHAPING_TYPE_X       3    // Shaper type for X
+  #define SHAPING_FREQ_X    40.0    // (Hz) Ringing frequency of X
+  #define SHAPING_ZETA_X     0.1    // Damping ratio of X (0-0.99)
+  #define SHAPING_TYPE_Y       3    // Shaper type for Y
+  #define SHAPING_FREQ_Y    40.0    // (Hz) Ringing frequency of Y
+  #define SHAPING_ZETA_Y     0.1    // Damping ratio of Y (0-0.99)
+  //#define SHAPING_BUFFER_SIZE 256 // Delayed steps held per axis. By default, enough for the X/Y steps
+                                    // at DEFAULT_MAX_FEEDRATE during one period. M593 counts overflows.
+#endif
+
 // @section leveling
 
 /**
@@ -1826,6 +1899,10 @@
   //#define ARC_SEGMENTS_PER_R    1 // Max segment length, MM_PER = Min
   #define MIN_ARC_SEGMENTS       24 // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50 // Use feedrate to choose segment length (with MM_PER_ARC_SEGMENT as the minimum)
+  //#define ARC_CHORD_TOLERANCE 0.01 // (mm) Use the radius to choose segment length so chords stay this close to the arc. Set with M930, save with M500.
+  #ifdef ARC_CHORD_TOLERANCE
+    #define ARC_SEGMENT_MIN_TIME   5 // (ms) Shortest segment at the arc's feedrate, doubled while the planner is under half full
+  #endif
   #define N_ARC_CORRECTION       25 // Number of interpolated segments between corrections
   #define ARC_P_CIRCLES           // Enable the 'P' parameter to specify complete circles
   //#define CNC_WORKSPACE_PLANES    // Allow G2/G3 to operate in XY, ZX, or YZ planes
@@ -1835,6 +1912,16 @@
 // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
 //#define BEZIER_CURVE_SUPPORT
 
+/**
+ * Delta Adaptive Segmentation
+ *
+ * Split DELTA moves only where the effector would stray from the straight
+ * line by more than this, and where the move crosses a bilinear mesh line.
+ * This queues far fewer planner blocks for long moves. DELTA_SEGMENTS_PER_SECOND
+ * (M665 S) now only limits how finely a move is split. (UBL keeps its own.)
+ */
+//#define DELTA_SEGMENT_TOLERANCE 0.01 // (mm) Tower path deviation allowed at a segment's middle
+
 /**
  * Direct Stepping
  *
@@ -1974,6 +2061,16 @@
 // :[0, 2, 4, 8, 16, 32, 64, 128, 256]
 #define TX_BUFFER_SIZE 256
 
+// Drop auto-reports (M155, M27 S) when the TX buffer has fewer than this many bytes free,
+// instead of waiting for a slow host. M111 shows the number of dropped reports.
+// AVR, DUE, STM32, and LINUX only. Must be less than the TX buffer of a hardware serial port:
+// TX_BUFFER_SIZE on AVR and DUE, SERIAL_TX_BUFFER_SIZE (64) on STM32.
+//#define SERIAL_DROP_AUTO_REPORTS 64
+
+// Enable this option to collect and display (M111) the time spent
+// waiting for room in the TX buffer. AVR only.
+//#define SERIAL_STATS_TX_BLOCKED
+
 // Host Receive Buffer Size
 // Without XON/XOFF flow control (see SERIAL_XON_XOFF below) 32 bytes should be enough.
 // To use flow control, set this buffer size to at least 1024 bytes.
@@ -3251,6 +3348,16 @@
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
 #endif
 
+/**
+ * Binary G-code
+ * Accept compact binary frames in place of text lines from the host or SD.
+ * Numeric parameters arrive as floats with a CRC-16, and no text parsing.
+ * Frames and text lines may be mixed. See feature/binary_gcode.h for the format.
+ * Commands with a string argument, and M108, M112, and M410, must be sent as text.
+ * Requires FASTER_GCODE_PARSER.
+ */
+//#define BINARY_GCODE
+
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
@@ -3655,3 +3762,36 @@
 
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
+
+//
+// M990 - Motion benchmark (linux_native only)
+// Time the G-code parser, planner and stepper ISR phases on the host clock and
+// count segments and blocks. Replay G-code with buildroot/share/scripts/linux_benchmark.sh
+//
+//#define MOTION_BENCHMARK
+
+//
+// M991 - G-code profiler
+// Count the calls to each G-code and the time spent in its handler. M991 R resets.
+//
+//#define GCODE_PROFILER
+#if ENABLED(GCODE_PROFILER)
+  #define GCODE_PROFILER_SLOTS 32   // Distinct commands to track
+#endif
+
+//
+// M992 - Event trace
+// Record timestamped planner, stepper, command queue, and idle() events in RAM.
+// M992 sends them in binary. Convert a capture to a Chrome trace or CSV with
+// buildroot/share/scripts/event_trace.py
+//
+//#define EVENT_TRACE
+#if ENABLED(EVENT_TRACE)
+  #define EVENT_TRACE_SIZE 512      // Events kept, 8 bytes each
+#endif
+
+// Let feature modules add G/M-codes at runtime with gcode.register_handler()
+//#define GCODE_HANDLER_REGISTRY
+#if ENABLED(GCODE_HANDLER_REGISTRY)
+  #define GCODE_REGISTRY_SIZE 8     // Most handlers that can be added
+#endif